@@ -17,6 +17,8 @@
 #define LOG_NDEBUG 0
 #define LOG_TAG "BootAnimation"
 
+#include <future>
+#include <memory>
 #include <vector>
 
 #include <stdint.h>
@@ -247,22 +249,36 @@ status_t BootAnimation::initTexture(Texture* texture, AssetManager& assets,
     return NO_ERROR;
 }
 
-status_t BootAnimation::initTexture(FileMap* map, int* width, int* height) {
-    AndroidBitmapInfo bitmapInfo;
-    void* pixels = decodeImage(map->getDataPtr(), map->getDataLength(), &bitmapInfo);
-    auto pixelDeleter = std::unique_ptr<void, decltype(free)*>{ pixels, free };
+namespace {
+
+struct DecodedFrame {
+    std::unique_ptr<void, decltype(free)*> pixels{nullptr, free};
+    AndroidBitmapInfo info;
+};
+
+} // namespace
+
+static DecodedFrame decodeFrame(FileMap* map) {
+    DecodedFrame frame;
+    frame.pixels.reset(decodeImage(map->getDataPtr(), map->getDataLength(), &frame.info));
 
     // FileMap memory is never released until application exit.
-    // Release it now as the texture is already loaded and the memory used for
+    // Release it now as the frame is already decoded and the memory used for
     // the packed resource can be released.
     delete map;
 
+    return frame;
+}
+
+static status_t uploadFrame(const DecodedFrame& frame, bool useNpotTextures,
+        int* width, int* height) {
+    const void* pixels = frame.pixels.get();
     if (!pixels) {
         return NO_INIT;
     }
 
-    const int w = bitmapInfo.width;
-    const int h = bitmapInfo.height;
+    const int w = frame.info.width;
+    const int h = frame.info.height;
 
     GLint crop[4] = { 0, h, w, -h };
     int tw = 1 << (31 - __builtin_clz(w));
@@ -270,9 +286,9 @@ status_t BootAnimation::initTexture(FileMap* map, int* width, int* height) {
     if (tw < w) tw <<= 1;
     if (th < h) th <<= 1;
 
-    switch (bitmapInfo.format) {
+    switch (frame.info.format) {
         case ANDROID_BITMAP_FORMAT_RGBA_8888:
-            if (!mUseNpotTextures && (tw != w || th != h)) {
+            if (!useNpotTextures && (tw != w || th != h)) {
                 glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, tw, th, 0, GL_RGBA,
                         GL_UNSIGNED_BYTE, nullptr);
                 glTexSubImage2D(GL_TEXTURE_2D, 0,
@@ -284,7 +300,7 @@ status_t BootAnimation::initTexture(FileMap* map, int* width, int* height) {
             break;
 
         case ANDROID_BITMAP_FORMAT_RGB_565:
-            if (!mUseNpotTextures && (tw != w || th != h)) {
+            if (!useNpotTextures && (tw != w || th != h)) {
                 glTexImage2D(GL_TEXTURE_2D, 0, GL_RGB, tw, th, 0, GL_RGB,
                         GL_UNSIGNED_SHORT_5_6_5, nullptr);
                 glTexSubImage2D(GL_TEXTURE_2D, 0,
@@ -306,6 +322,10 @@ status_t BootAnimation::initTexture(FileMap* map, int* width, int* height) {
     return NO_ERROR;
 }
 
+status_t BootAnimation::initTexture(FileMap* map, int* width, int* height) {
+    return uploadFrame(decodeFrame(map), mUseNpotTextures, width, height);
+}
+
 class BootAnimation::DisplayEventCallback : public LooperCallback {
     BootAnimation* mBootAnimation;
 
@@ -1128,6 +1148,33 @@ bool BootAnimation::preloadZip(Animation& animation) {
         }
     }
 
+    // Held poses are often stored as runs of identical frames. In a looping part
+    // each frame keeps its own texture, so let a repeat share the texture of the
+    // frame before it instead of being decoded and uploaded again.
+    for (Animation::Part& part : animation.parts) {
+        if (part.count == 1) {
+            continue;
+        }
+        // Compare against the last frame that is decoded, since repeats drop their map.
+        size_t sourceIdx = 0;
+        for (size_t frameIdx = 1; frameIdx < part.frames.size(); frameIdx++) {
+            const Animation::Frame& prev(part.frames[sourceIdx]);
+            const Animation::Frame& cur(part.frames[frameIdx]);
+            if (cur.trimWidth != prev.trimWidth || cur.trimHeight != prev.trimHeight ||
+                cur.trimX != prev.trimX || cur.trimY != prev.trimY ||
+                cur.map->getDataLength() != prev.map->getDataLength() ||
+                memcmp(cur.map->getDataPtr(), prev.map->getDataPtr(),
+                       cur.map->getDataLength()) != 0) {
+                sourceIdx = frameIdx;
+                continue;
+            }
+            Animation::Frame& frame(part.frames.editItemAt(frameIdx));
+            frame.sameAsPrevious = true;
+            delete frame.map;
+            frame.map = nullptr;
+        }
+    }
+
     zip->endIteration(cookie);
 
     return true;
@@ -1269,6 +1316,11 @@ bool BootAnimation::playAnimation(const Animation& animation) {
             bool displayProgress = animation.progressEnabled &&
                 (i == (pcount -1)) && currentProgress != 0;
 
+            // On the first pass every frame has to be decoded before it can be uploaded.
+            // Decode the next frame on a worker thread while this one is drawn and
+            // presented, so the PNG decode no longer eats into the frame budget.
+            std::future<DecodedFrame> nextFrame;
+
             for (size_t j=0 ; j<fcount ; j++) {
                 if (shouldStopPlayingPart(part, fadedFramesCount, lastDisplayedProgress)) break;
 
@@ -1282,6 +1334,9 @@ bool BootAnimation::playAnimation(const Animation& animation) {
 
                 if (r > 0) {
                     glBindTexture(GL_TEXTURE_2D, frame.tid);
+                } else if (frame.sameAsPrevious) {
+                    frame.tid = part.frames[j - 1].tid;
+                    glBindTexture(GL_TEXTURE_2D, frame.tid);
                 } else {
                     if (part.count != 1) {
                         glGenTextures(1, &frame.tid);
@@ -1289,8 +1344,15 @@ bool BootAnimation::playAnimation(const Animation& animation) {
                         glTexParameterx(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
                         glTexParameterx(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
                     }
+                    DecodedFrame decoded = nextFrame.valid() ? nextFrame.get()
+                                                             : decodeFrame(frame.map);
                     int w, h;
-                    initTexture(frame.map, &w, &h);
+                    uploadFrame(decoded, mUseNpotTextures, &w, &h);
+                }
+                if (r == 0 && !nextFrame.valid() && j + 1 < fcount &&
+                        !part.frames[j + 1].sameAsPrevious) {
+                    nextFrame = std::async(std::launch::async, decodeFrame,
+                                           part.frames[j + 1].map);
                 }
 
                 const int xc = animationX + frame.trimX;
@@ -1384,7 +1446,9 @@ bool BootAnimation::playAnimation(const Animation& animation) {
             const size_t fcount = part.frames.size();
             for (size_t j = 0; j < fcount; j++) {
                 const Animation::Frame& frame(part.frames[j]);
-                glDeleteTextures(1, &frame.tid);
+                if (!frame.sameAsPrevious) {
+                    glDeleteTextures(1, &frame.tid);
+                }
             }
         }
     }
@@ -67,6 +67,8 @@ public:
             int trimY;
             int trimWidth;
             int trimHeight;
+            // Byte-identical to the previous frame, so it draws with that frame's texture.
+            bool sameAsPrevious = false;
             mutable GLuint tid;
             bool operator < (const Frame& rhs) const {
                 return name < rhs.name;
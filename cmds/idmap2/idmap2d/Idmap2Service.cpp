@@ -74,6 +74,11 @@ PolicyBitmask ConvertAidlArgToPolicyBitmask(int32_t arg) {
   return static_cast<PolicyBitmask>(arg);
 }
 
+bool IsSameFile(const struct stat& a, const struct stat& b) {
+  return a.st_dev == b.st_dev && a.st_ino == b.st_ino && a.st_size == b.st_size &&
+         a.st_mtim.tv_sec == b.st_mtim.tv_sec && a.st_mtim.tv_nsec == b.st_mtim.tv_nsec;
+}
+
 }  // namespace
 
 namespace android::os {
@@ -129,7 +134,7 @@ Status Idmap2Service::verifyIdmap(const std::string& target_path, const std::str
     return ok();
   }
 
-  const auto overlay = OverlayResourceContainer::FromPath(overlay_path);
+  const auto overlay = GetOverlayContainer(overlay_path);
   if (!overlay) {
     *_aidl_return = false;
     LOG(WARNING) << "failed to load overlay '" << overlay_path << "'";
@@ -137,7 +142,7 @@ Status Idmap2Service::verifyIdmap(const std::string& target_path, const std::str
   }
 
   auto up_to_date =
-      header->IsUpToDate(*GetPointer(*target), **overlay, overlay_name,
+      header->IsUpToDate(*GetPointer(*target), *GetPointer(*overlay), overlay_name,
                          ConvertAidlArgToPolicyBitmask(fulfilled_policies), enforce_overlayable);
 
   *_aidl_return = static_cast<bool>(up_to_date);
@@ -176,13 +181,13 @@ Status Idmap2Service::createIdmap(const std::string& target_path, const std::str
     return error("failed to load target '%s'" + target_path);
   }
 
-  const auto overlay = OverlayResourceContainer::FromPath(overlay_path);
+  const auto overlay = GetOverlayContainer(overlay_path);
   if (!overlay) {
     return error("failed to load apk overlay '%s'" + overlay_path);
   }
 
-  const auto idmap = Idmap::FromContainers(*GetPointer(*target), **overlay, overlay_name,
-                                           policy_bitmask, enforce_overlayable);
+  const auto idmap = Idmap::FromContainers(*GetPointer(*target), *GetPointer(*overlay),
+                                           overlay_name, policy_bitmask, enforce_overlayable);
   if (!idmap) {
     return error(idmap.GetErrorMessage());
   }
@@ -219,11 +224,51 @@ idmap2::Result<Idmap2Service::TargetResourceContainerPtr> Idmap2Service::GetTarg
     return {framework_apk_cache_.get()};
   }
 
+  struct stat st;
+  if (stat(target_path.c_str(), &st) != 0) {
+    auto target = TargetResourceContainer::FromPath(target_path);
+    if (!target) {
+      return target.GetError();
+    }
+    return {std::move(*target)};
+  }
+
+  // Containers initialize their resources lazily and their AssetManager2 caches lookups, neither of
+  // which is synchronized, so the cached container is only handed out while no other binder thread
+  // holds it. Copies are only taken under the lock, so use_count() cannot grow behind our back.
+  std::lock_guard<std::mutex> lock(target_apk_cache_lock_);
+  if (target_apk_cache_ && target_apk_cache_->path == target_path &&
+      IsSameFile(target_apk_cache_->st, st) && target_apk_cache_->container.use_count() == 1) {
+    return {target_apk_cache_->container};
+  }
+
   auto target = TargetResourceContainer::FromPath(target_path);
   if (!target) {
     return target.GetError();
   }
-  return {std::move(*target)};
+  std::shared_ptr<TargetResourceContainer> container = std::move(*target);
+  target_apk_cache_ = TargetApkCacheEntry{target_path, st, container};
+  return {std::move(container)};
+}
+
+idmap2::Result<Idmap2Service::OverlayResourceContainerPtr> Idmap2Service::GetOverlayContainer(
+    const std::string& overlay_path) {
+  struct stat st;
+  if (stat(overlay_path.c_str(), &st) == 0) {
+    // As with the target cache, the container serializes its data lazily without a lock, so it is
+    // only handed out while no other binder thread holds it.
+    std::lock_guard<std::mutex> lock(frro_cache_lock_);
+    if (frro_cache_ && frro_cache_->path == overlay_path && IsSameFile(frro_cache_->st, st) &&
+        frro_cache_->container.use_count() == 1) {
+      return {frro_cache_->container};
+    }
+  }
+
+  auto overlay = OverlayResourceContainer::FromPath(overlay_path);
+  if (!overlay) {
+    return overlay.GetError();
+  }
+  return {std::move(*overlay)};
 }
 
 Status Idmap2Service::createFabricatedOverlay(
@@ -266,7 +311,7 @@ Status Idmap2Service::createFabricatedOverlay(
                                     path.c_str(), uid));
   }
 
-  const auto frro = builder.Build();
+  auto frro = builder.Build();
   if (!frro) {
     return error(StringPrintf("failed to serialize '%s:%s': %s", overlay.packageName.c_str(),
                               overlay.overlayName.c_str(), frro.GetErrorMessage().c_str()));
@@ -282,11 +327,19 @@ Status Idmap2Service::createFabricatedOverlay(
     unlink(path.c_str());
     return error("failed to write to frro path " + path + ": " + result.GetErrorMessage());
   }
+  fout.close();
   if (fout.fail()) {
     unlink(path.c_str());
     return error("failed to write to frro path " + path);
   }
 
+  struct stat st;
+  if (stat(path.c_str(), &st) == 0) {
+    std::lock_guard<std::mutex> lock(frro_cache_lock_);
+    frro_cache_ = FrroCacheEntry{path, st, FabricatedOverlayContainer::FromOverlay(std::move(*frro),
+                                                                                  path)};
+  }
+
   os::FabricatedOverlayInfo out_info;
   out_info.packageName = overlay.packageName;
   out_info.overlayName = overlay.overlayName;
@@ -365,6 +418,13 @@ binder::Status Idmap2Service::deleteFabricatedOverlay(const std::string& overlay
                                     idmap_path.c_str(), uid));
   }
 
+  {
+    std::lock_guard<std::mutex> lock(frro_cache_lock_);
+    if (frro_cache_ && frro_cache_->path == overlay_path) {
+      frro_cache_.reset();
+    }
+  }
+
   if (unlink(overlay_path.c_str()) != 0) {
     *_aidl_return = false;
     return error("failed to unlink " + overlay_path + ": " + strerror(errno));
@@ -24,8 +24,11 @@
 #include <idmap2/ResourceContainer.h>
 #include <idmap2/Result.h>
 
+#include <sys/stat.h>
+
 #include <filesystem>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <vector>
 
@@ -74,14 +77,41 @@ class Idmap2Service : public BinderService<Idmap2Service>, public BnIdmap2 {
   // be able to be recalculated if idmap2 dies and restarts.
   std::unique_ptr<idmap2::TargetResourceContainer> framework_apk_cache_;
 
+  // The most recently loaded non-framework target. OverlayManagerService verifies and creates the
+  // idmaps of all overlays for a target back to back, so this avoids reparsing the target APK for
+  // each of them. The entry is dropped as soon as the file on disk changes. Containers are not
+  // thread-safe, so the entry is only reused by one binder thread at a time.
+  struct TargetApkCacheEntry {
+    std::string path;
+    struct stat st;
+    std::shared_ptr<idmap2::TargetResourceContainer> container;
+  };
+  std::mutex target_apk_cache_lock_;
+  std::optional<TargetApkCacheEntry> target_apk_cache_;
+
+  // The most recently created fabricated overlay. OverlayManagerService creates the idmap of a
+  // fabricated overlay right after registering it, so keeping the overlay that was just written
+  // avoids reading and parsing the frro back from disk. Like the target entry, it is only reused by
+  // one binder thread at a time.
+  struct FrroCacheEntry {
+    std::string path;
+    struct stat st;
+    std::shared_ptr<idmap2::OverlayResourceContainer> container;
+  };
+  std::mutex frro_cache_lock_;
+  std::optional<FrroCacheEntry> frro_cache_;
+
   std::optional<std::filesystem::directory_iterator> frro_iter_;
 
   template <typename T>
-  using MaybeUniquePtr = std::variant<std::unique_ptr<T>, T*>;
+  using MaybeUniquePtr = std::variant<std::unique_ptr<T>, T*, std::shared_ptr<T>>;
 
   using TargetResourceContainerPtr = MaybeUniquePtr<idmap2::TargetResourceContainer>;
   idmap2::Result<TargetResourceContainerPtr> GetTargetContainer(const std::string& target_path);
 
+  using OverlayResourceContainerPtr = MaybeUniquePtr<idmap2::OverlayResourceContainer>;
+  idmap2::Result<OverlayResourceContainerPtr> GetOverlayContainer(const std::string& overlay_path);
+
   template <typename T>
   WARN_UNUSED static const T* GetPointer(const MaybeUniquePtr<T>& ptr);
 };
@@ -92,6 +122,10 @@ const T* Idmap2Service::GetPointer(const MaybeUniquePtr<T>& ptr) {
   if (u != nullptr) {
     return *u;
   }
+  auto shared = std::get_if<std::shared_ptr<T>>(&ptr);
+  if (shared != nullptr) {
+    return shared->get();
+  }
   return std::get<std::unique_ptr<T>>(ptr).get();
 }
 
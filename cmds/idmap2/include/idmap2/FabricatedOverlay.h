@@ -82,7 +82,8 @@ struct FabricatedOverlay {
 
 struct FabricatedOverlayContainer : public OverlayResourceContainer {
   static Result<std::unique_ptr<FabricatedOverlayContainer>> FromPath(std::string path);
-  static std::unique_ptr<FabricatedOverlayContainer> FromOverlay(FabricatedOverlay&& overlay);
+  static std::unique_ptr<FabricatedOverlayContainer> FromOverlay(FabricatedOverlay&& overlay,
+                                                                 std::string path = {});
 
   WARN_UNUSED OverlayManifestInfo GetManifestInfo() const;
 
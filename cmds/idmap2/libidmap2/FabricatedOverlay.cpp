@@ -246,9 +246,10 @@ Result<std::unique_ptr<FabContainer>> FabContainer::FromPath(std::string path) {
       new FabricatedOverlayContainer(std::move(*overlay), std::move(path)));
 }
 
-std::unique_ptr<FabricatedOverlayContainer> FabContainer::FromOverlay(FabricatedOverlay&& overlay) {
+std::unique_ptr<FabricatedOverlayContainer> FabContainer::FromOverlay(FabricatedOverlay&& overlay,
+                                                                      std::string path) {
   return std::unique_ptr<FabContainer>(
-      new FabricatedOverlayContainer(std::move(overlay), {} /* path */));
+      new FabricatedOverlayContainer(std::move(overlay), std::move(path)));
 }
 
 OverlayManifestInfo FabContainer::GetManifestInfo() const {
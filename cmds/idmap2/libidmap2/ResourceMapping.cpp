@@ -20,6 +20,7 @@
 #include <memory>
 #include <set>
 #include <string>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -48,10 +49,35 @@ std::string ConcatPolicies(const std::vector<std::string>& policies) {
   return message;
 }
 
+Result<Unit> CheckOverlayablePolicies(const OverlayManifestInfo& overlay_info,
+                                      const PolicyBitmask& fulfilled_policies,
+                                      const android::OverlayableInfo& overlayable_info) {
+  if (overlay_info.target_name != overlayable_info.name) {
+    // If the overlay supplies a target overlayable name, the resource must belong to the
+    // overlayable defined with the specified name to be overlaid.
+    return Error(R"(<overlay> android:targetName "%s" does not match overlayable name "%s")",
+                 overlay_info.target_name.c_str(), overlayable_info.name.c_str());
+  }
+
+  // Enforce policy restrictions if the resource is declared as overlayable.
+  if ((overlayable_info.policy_flags & fulfilled_policies) == 0) {
+    return Error(R"(overlay with policies "%s" does not fulfill any overlayable policies "%s")",
+                 ConcatPolicies(BitmaskToPolicies(fulfilled_policies)).c_str(),
+                 ConcatPolicies(BitmaskToPolicies(overlayable_info.policy_flags)).c_str());
+  }
+
+  return Result<Unit>({});
+}
+
+// Results of CheckOverlayablePolicies keyed by overlayable. Every resource of an overlayable
+// shares the same name and policies, so the check only needs to run once per overlayable.
+using OverlayableCheckCache = std::unordered_map<const android::OverlayableInfo*, Result<Unit>>;
+
 Result<Unit> CheckOverlayable(const TargetResourceContainer& target,
                               const OverlayManifestInfo& overlay_info,
                               const PolicyBitmask& fulfilled_policies,
-                              const ResourceId& target_resource) {
+                              const ResourceId& target_resource,
+                              OverlayableCheckCache& cache) {
   constexpr const PolicyBitmask kDefaultPolicies =
       PolicyFlags::ODM_PARTITION | PolicyFlags::OEM_PARTITION | PolicyFlags::SYSTEM_PARTITION |
       PolicyFlags::VENDOR_PARTITION | PolicyFlags::PRODUCT_PARTITION | PolicyFlags::SIGNATURE |
@@ -85,21 +111,13 @@ Result<Unit> CheckOverlayable(const TargetResourceContainer& target,
     return Error("target resource has no overlayable declaration");
   }
 
-  if (overlay_info.target_name != (*overlayable_info)->name) {
-    // If the overlay supplies a target overlayable name, the resource must belong to the
-    // overlayable defined with the specified name to be overlaid.
-    return Error(R"(<overlay> android:targetName "%s" does not match overlayable name "%s")",
-                 overlay_info.target_name.c_str(), (*overlayable_info)->name.c_str());
-  }
-
-  // Enforce policy restrictions if the resource is declared as overlayable.
-  if (((*overlayable_info)->policy_flags & fulfilled_policies) == 0) {
-    return Error(R"(overlay with policies "%s" does not fulfill any overlayable policies "%s")",
-                 ConcatPolicies(BitmaskToPolicies(fulfilled_policies)).c_str(),
-                 ConcatPolicies(BitmaskToPolicies((*overlayable_info)->policy_flags)).c_str());
+  auto cached = cache.find(*overlayable_info);
+  if (cached == cache.end()) {
+    cached = cache.emplace(*overlayable_info,
+                           CheckOverlayablePolicies(overlay_info, fulfilled_policies,
+                                                    **overlayable_info)).first;
   }
-
-  return Result<Unit>({});
+  return cached->second;
 }
 
 std::string GetDebugResourceName(const ResourceContainer& container, ResourceId resid) {
@@ -123,6 +141,7 @@ Result<ResourceMapping> ResourceMapping::FromContainers(const TargetResourceCont
   }
 
   ResourceMapping mapping;
+  OverlayableCheckCache overlayable_checks;
   for (const auto& overlay_pair : overlay_data->pairs) {
     const auto target_resid = target.GetResourceId(overlay_pair.resource_name);
     if (!target_resid) {
@@ -132,7 +151,8 @@ Result<ResourceMapping> ResourceMapping::FromContainers(const TargetResourceCont
 
     if (enforce_overlayable) {
       // Filter out resources the overlay is not allowed to override.
-      auto overlayable = CheckOverlayable(target, overlay_info, fulfilled_policies, *target_resid);
+      auto overlayable = CheckOverlayable(target, overlay_info, fulfilled_policies, *target_resid,
+                                          overlayable_checks);
       if (!overlayable) {
         log_info.Warning(LogMessage() << "overlay '" << overlay.GetPath()
                                       << "' is not allowed to overlay resource '"
@@ -20,7 +20,10 @@
 
 #include <algorithm>
 #include <sstream>
+#include <stdlib.h>
+#include <string.h>
 #include <unistd.h>
+#include <utility>
 
 bool isValidChar(char c) {
     uint8_t v = (uint8_t)c;
@@ -38,6 +41,15 @@ std::string trim(const std::string& s, const std::string& charset) {
     return s.substr(head, tail - head + 1);
 }
 
+// Same as trim(s.substr(pos, len), DEFAULT_WHITESPACE), but copies the result only once.
+static std::string trimmedSubstr(const std::string& s, size_t pos, size_t len) {
+    if (pos >= s.size()) return "";
+    size_t end = len < s.size() - pos ? pos + len : s.size();
+    while (pos < end && DEFAULT_WHITESPACE.find(s[pos]) != std::string::npos) pos++;
+    while (end > pos && DEFAULT_WHITESPACE.find(s[end - 1]) != std::string::npos) end--;
+    return s.substr(pos, end - pos);
+}
+
 static inline std::string toLowerStr(const std::string& s) {
     std::string res(s);
     std::transform(res.begin(), res.end(), res.begin(), ::tolower);
@@ -70,7 +82,7 @@ static void split(const std::string& line, std::vector<std::string>& words,
         if (found != base) {
             std::string word = (*func) (line.substr(base, found - base));
             if (!word.empty()) {
-                words.push_back(word);
+                words.push_back(std::move(word));
             }
         }
         if (found == line.npos) break;
@@ -136,7 +148,7 @@ record_t parseRecordByColumns(const std::string& line, const std::vector<int>& i
             return record;
         }
         while (idx < lineSize && delimiters.find(line[idx++]) == std::string::npos);
-        record.push_back(trimDefault(line.substr(lastIndex, idx - lastIndex)));
+        record.push_back(trimmedSubstr(line, lastIndex, idx - lastIndex));
         lastBeginning = lastIndex;
         lastIndex = idx;
     }
@@ -148,7 +160,7 @@ record_t parseRecordByColumns(const std::string& line, const std::vector<int>& i
             record.pop_back();
             beginning = lastBeginning;
         }
-        record.push_back(trimDefault(line.substr(beginning, lineSize - beginning)));
+        record.push_back(trimmedSubstr(line, beginning, lineSize - beginning));
     }
     return record;
 }
@@ -183,7 +195,7 @@ bool stripPrefix(std::string* line, const char* key, bool endAtDelimiter) {
         if (j == len || isValidChar(line->at(j))) return false;
     }
 
-    line->assign(trimDefault(line->substr(j)));
+    line->assign(trimmedSubstr(*line, j, std::string::npos));
     return true;
 }
 
@@ -204,7 +216,7 @@ bool stripSuffix(std::string* line, const char* key, bool endAtDelimiter) {
         if (j < 0 || isValidChar(line->at(j))) return false;
     }
 
-    line->assign(trimDefault(line->substr(0, j+1)));
+    line->assign(trimmedSubstr(*line, 0, j + 1));
     return true;
 }
 
@@ -237,24 +249,29 @@ double toDouble(const std::string& s) {
 Reader::Reader(const int fd)
 {
     mFile = fdopen(fd, "r");
-    mBuffer = new char[1024];
+    // getline() grows the buffer with realloc() and keeps it across calls.
+    mBuffer = nullptr;
+    mBufferSize = 0;
     mStatus = mFile == nullptr ? "Invalid fd " + std::to_string(fd) : "";
 }
 
 Reader::~Reader()
 {
     if (mFile != nullptr) fclose(mFile);
-    delete[] mBuffer;
+    free(mBuffer);
 }
 
 bool Reader::readLine(std::string* line) {
     if (mFile == nullptr) return false;
 
-    size_t len = 0;
-    ssize_t read = getline(&mBuffer, &len, mFile);
+    ssize_t read = getline(&mBuffer, &mBufferSize, mFile);
     if (read != -1) {
-        std::string s(mBuffer);
-        line->assign(trim(s, DEFAULT_NEWLINE));
+        // Trim the newlines straight out of the line buffer.
+        size_t head = 0;
+        size_t tail = strnlen(mBuffer, read);
+        while (head < tail && DEFAULT_NEWLINE.find(mBuffer[head]) != std::string::npos) head++;
+        while (tail > head && DEFAULT_NEWLINE.find(mBuffer[tail - 1]) != std::string::npos) tail--;
+        line->assign(mBuffer + head, tail - head);
         return true;
     }
     if (!feof(mFile)) {
@@ -311,9 +328,10 @@ Table::addEnumNameToValue(const char* enumName, const int enumValue)
 bool
 Table::insertField(ProtoOutputStream* proto, const std::string& name, const std::string& value)
 {
-    if (mFields.find(name) == mFields.end()) return false;
+    auto field = mFields.find(name);
+    if (field == mFields.end()) return false;
 
-    uint64_t found = mFields[name];
+    uint64_t found = field->second;
     record_t repeats; // used for repeated fields
     switch ((found & FIELD_COUNT_MASK) | (found & FIELD_TYPE_MASK)) {
         case FIELD_COUNT_SINGLE | FIELD_TYPE_DOUBLE:
@@ -343,14 +361,16 @@ Table::insertField(ProtoOutputStream* proto, const std::string& name, const std:
             return false;
         case FIELD_COUNT_SINGLE | FIELD_TYPE_ENUM:
             // if the field has its own enum mapping, use this, otherwise use general name to value mapping.
-            if (mEnums.find(name) != mEnums.end()) {
-                if (mEnums[name].find(value) != mEnums[name].end()) {
-                    proto->write(found, mEnums[name][value]);
+            if (auto enums = mEnums.find(name); enums != mEnums.end()) {
+                auto enumValue = enums->second.find(value);
+                if (enumValue != enums->second.end()) {
+                    proto->write(found, enumValue->second);
                 } else {
                     proto->write(found, 0); // TODO: should get the default enum value (Unknown)
                 }
-            } else if (mEnumValuesByName.find(value) != mEnumValuesByName.end()) {
-                proto->write(found, mEnumValuesByName[value]);
+            } else if (auto enumValue = mEnumValuesByName.find(value);
+                    enumValue != mEnumValuesByName.end()) {
+                proto->write(found, enumValue->second);
             } else if (isNumber(value)) {
                 proto->write(found, toInt(value));
             } else {
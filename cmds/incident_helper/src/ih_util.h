@@ -118,6 +118,7 @@ public:
 private:
     FILE* mFile;
     char* mBuffer;
+    size_t mBufferSize;
     std::string mStatus;
 };
 
@@ -123,7 +123,7 @@ status_t strip_field(ProtoOutputStream* out, const sp<ProtoReader>& in,
 // ================================================================================
 class FieldStripper {
 public:
-    FieldStripper(const Privacy* restrictions, const sp<ProtoReader>& data,
+    FieldStripper(const Privacy* restrictions, const sp<EncodedBuffer>& data,
             uint8_t bufferLevel);
 
     ~FieldStripper();
@@ -151,9 +151,10 @@ private:
     const Privacy* mRestrictions;
 
     /**
-     * The current buffer.
+     * The current buffer. Each strip or write reads it through a fresh reader, so the
+     * same filtered data can be written to several outputs and filtered further.
      */
-    sp<ProtoReader> mData;
+    sp<EncodedBuffer> mData;
 
     /**
      * The current size of the buffer inside mData.
@@ -166,24 +167,26 @@ private:
      */
     uint8_t mCurrentLevel;
 
+    /**
+     * The pooled buffer holding mData once it has been filtered at least once, or null
+     * while mData is still the caller's buffer.
+     */
     sp<EncodedBuffer> mEncodedBuffer;
 };
 
-FieldStripper::FieldStripper(const Privacy* restrictions, const sp<ProtoReader>& data,
+FieldStripper::FieldStripper(const Privacy* restrictions, const sp<EncodedBuffer>& data,
             uint8_t bufferLevel)
         :mRestrictions(restrictions),
          mData(data),
          mSize(data->size()),
          mCurrentLevel(bufferLevel),
-         mEncodedBuffer(get_buffer_from_pool()) {
-    if (mSize < 0) {
-        ALOGW("FieldStripper constructed with a ProtoReader that doesn't support size."
-                " Data will be missing.");
-    }
+         mEncodedBuffer() {
 }
 
 FieldStripper::~FieldStripper() {
-    return_buffer_to_pool(mEncodedBuffer);
+    if (mEncodedBuffer != nullptr) {
+        return_buffer_to_pool(mEncodedBuffer);
+    }
 }
 
 status_t FieldStripper::strip(const uint8_t privacyPolicy) {
@@ -191,8 +194,6 @@ status_t FieldStripper::strip(const uint8_t privacyPolicy) {
     // buffer, then we can skip it.
     if (mCurrentLevel < privacyPolicy) {
         PrivacySpec spec(privacyPolicy);
-        mEncodedBuffer->clear();
-        ProtoOutputStream proto(mEncodedBuffer);
 
         // Optimization when no strip happens.
         if (mRestrictions == NULL || spec.RequireAll()) {
@@ -202,21 +203,33 @@ status_t FieldStripper::strip(const uint8_t privacyPolicy) {
             return NO_ERROR;
         }
 
-        while (mData->hasNext()) {
-            status_t err = strip_field(&proto, mData, mRestrictions, spec, 0);
+        // The output never shares a buffer with the input: ProtoOutputStream reserves room for
+        // nested message sizes while writing, so it can run ahead of the reader.
+        sp<EncodedBuffer> stripped = get_buffer_from_pool();
+        ProtoOutputStream proto(stripped);
+        sp<ProtoReader> reader = mData->read();
+        while (reader->hasNext()) {
+            status_t err = strip_field(&proto, reader, mRestrictions, spec, 0);
             if (err != NO_ERROR) {
+                return_buffer_to_pool(stripped);
                 return err; // Error logged in strip_field.
             }
         }
 
-        if (mData->bytesRead() != mData->size()) {
+        if (reader->bytesRead() != mData->size()) {
             ALOGW("Buffer corrupted: expect %zu bytes, read %zu bytes", mData->size(),
-                    mData->bytesRead());
+                    reader->bytesRead());
+            return_buffer_to_pool(stripped);
             return BAD_VALUE;
         }
 
-        mData = proto.data();
+        // Compacts the nested message sizes in place.
         mSize = proto.size();
+        if (mEncodedBuffer != nullptr) {
+            return_buffer_to_pool(mEncodedBuffer);
+        }
+        mEncodedBuffer = stripped;
+        mData = stripped;
         mCurrentLevel = privacyPolicy;
     }
     return NO_ERROR;
@@ -224,12 +237,12 @@ status_t FieldStripper::strip(const uint8_t privacyPolicy) {
 
 status_t FieldStripper::writeData(int fd) {
     status_t err = NO_ERROR;
-    sp<ProtoReader> reader = mData;
     if (mData == nullptr) {
         // There had been an error processing the data. We won't write anything,
         // but we also won't return an error, because errors are fatal.
         return NO_ERROR;
     }
+    sp<ProtoReader> reader = mData->read();
     while (reader->readBuffer() != NULL) {
         err = WriteFully(fd, reader->readBuffer(), reader->currentToRead()) ? NO_ERROR : -errno;
         reader->move(reader->currentToRead());
@@ -278,7 +291,7 @@ status_t PrivacyFilter::writeData(const FdBuffer& buffer, uint8_t bufferLevel,
         });
 
     uint8_t privacyPolicy = PRIVACY_POLICY_LOCAL; // a.k.a. no filtering
-    FieldStripper fieldStripper(mRestrictions, buffer.data()->read(), bufferLevel);
+    FieldStripper fieldStripper(mRestrictions, buffer.data(), bufferLevel);
     for (const sp<FilterFd>& output: mOutputs) {
         // Do another level of filtering if necessary
         if (privacyPolicy != output->getPrivacyPolicy()) {
@@ -47,13 +47,18 @@ const Privacy* get_privacy_of_section(int id) {
     return NULL;
 }
 
+// Pooled buffers mostly hold section output read from pipes. Sizing their chunks to the default
+// pipe capacity lets a single read() drain a full pipe and keeps the number of chunk mappings low
+// for large sections such as meminfo or logs.
+const size_t kPooledBufferChunkSize = 64 * 1024;
+
 std::vector<sp<EncodedBuffer>> gBufferPool;
 std::mutex gBufferPoolLock;
 
 sp<EncodedBuffer> get_buffer_from_pool() {
     std::scoped_lock<std::mutex> lock(gBufferPoolLock);
     if (gBufferPool.size() == 0) {
-        return new EncodedBuffer();
+        return new EncodedBuffer(kPooledBufferChunkSize);
     }
     sp<EncodedBuffer> buffer = gBufferPool.back();
     gBufferPool.pop_back();
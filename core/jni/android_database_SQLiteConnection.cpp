@@ -652,8 +652,21 @@ enum CopyRowResult {
 
 static CopyRowResult copyRow(JNIEnv* env, CursorWindow* window,
         sqlite3_stmt* statement, int numColumns, int startPos, int addedRows) {
+    // Size the row's strings and blobs up front so that a row that does not
+    // fit is rejected before any of it is copied, instead of leaving the
+    // fields copied so far stranded on the window's heap.
+    size_t heapSize = 0;
+    for (int i = 0; i < numColumns; i++) {
+        int type = sqlite3_column_type(statement, i);
+        if (type == SQLITE_TEXT) {
+            heapSize += CursorWindow::heapSizeOf(sqlite3_column_bytes(statement, i) + 1);
+        } else if (type == SQLITE_BLOB) {
+            heapSize += CursorWindow::heapSizeOf(sqlite3_column_bytes(statement, i));
+        }
+    }
+
     // Allocate a new field directory for the row.
-    status_t status = window->allocRow();
+    status_t status = window->allocRowWithHeapSize(heapSize);
     if (status) {
         LOG_WINDOW("Failed allocating fieldDir at startPos %d row %d, error=%d",
                 startPos, addedRows, status);
@@ -108,15 +108,19 @@ static jint nativeGetUndequeuedBufferCount(JNIEnv* env, jclass clazz, jlong ptr)
     return queue->getUndequeuedBufferCount();
 }
 
+// The entry points below run on every frame or relayout and use the raw pointer rather than an
+// sp<>: the Java object holds a strong reference for as long as ptr is valid, so taking another
+// one on every call only adds a pair of atomic refcount updates to the ViewRootImpl sync path.
+
 static void nativeSetNextTransaction(JNIEnv* env, jclass clazz, jlong ptr, jlong transactionPtr) {
-    sp<BLASTBufferQueue> queue = reinterpret_cast<BLASTBufferQueue*>(ptr);
+    BLASTBufferQueue* queue = reinterpret_cast<BLASTBufferQueue*>(ptr);
     auto transaction = reinterpret_cast<SurfaceComposerClient::Transaction*>(transactionPtr);
     queue->setNextTransaction(transaction);
 }
 
 static void nativeUpdate(JNIEnv* env, jclass clazz, jlong ptr, jlong surfaceControl, jlong width,
                          jlong height, jint format, jlong transactionPtr) {
-    sp<BLASTBufferQueue> queue = reinterpret_cast<BLASTBufferQueue*>(ptr);
+    BLASTBufferQueue* queue = reinterpret_cast<BLASTBufferQueue*>(ptr);
     auto transaction = reinterpret_cast<SurfaceComposerClient::Transaction*>(transactionPtr);
     queue->update(reinterpret_cast<SurfaceControl*>(surfaceControl), width, height, format,
                   transaction);
@@ -124,7 +128,7 @@ static void nativeUpdate(JNIEnv* env, jclass clazz, jlong ptr, jlong surfaceCont
 
 static void nativeMergeWithNextTransaction(JNIEnv*, jclass clazz, jlong ptr, jlong transactionPtr,
                                            jlong framenumber) {
-    sp<BLASTBufferQueue> queue = reinterpret_cast<BLASTBufferQueue*>(ptr);
+    BLASTBufferQueue* queue = reinterpret_cast<BLASTBufferQueue*>(ptr);
     auto transaction = reinterpret_cast<SurfaceComposerClient::Transaction*>(transactionPtr);
     queue->mergeWithNextTransaction(transaction, framenumber);
 }
@@ -132,7 +136,7 @@ static void nativeMergeWithNextTransaction(JNIEnv*, jclass clazz, jlong ptr, jlo
 static void nativeSetTransactionCompleteCallback(JNIEnv* env, jclass clazz, jlong ptr,
                                                  jlong frameNumber,
                                                  jobject transactionCompleteCallback) {
-    sp<BLASTBufferQueue> queue = reinterpret_cast<BLASTBufferQueue*>(ptr);
+    BLASTBufferQueue* queue = reinterpret_cast<BLASTBufferQueue*>(ptr);
     if (transactionCompleteCallback == nullptr) {
         queue->setTransactionCompleteCallback(frameNumber, nullptr);
     } else {
@@ -145,7 +149,7 @@ static void nativeSetTransactionCompleteCallback(JNIEnv* env, jclass clazz, jlon
 }
 
 static jlong nativeGetLastAcquiredFrameNum(JNIEnv* env, jclass clazz, jlong ptr) {
-    sp<BLASTBufferQueue> queue = reinterpret_cast<BLASTBufferQueue*>(ptr);
+    BLASTBufferQueue* queue = reinterpret_cast<BLASTBufferQueue*>(ptr);
     return queue->getLastAcquiredFrameNum();
 }
 
@@ -46,6 +46,10 @@ struct {
     jmethodID dispatchAdditionalInfoEvent;
 } gBaseEventQueueClassInfo;
 
+// Number of events pulled from the sensor event queue per read. High-rate and batched sensors
+// deliver events in bursts, so reading larger chunks means fewer reads and acks per burst.
+static constexpr size_t kEventReadBatchSize = 64;
+
 struct SensorOffsets
 {
     jclass      clazz;
@@ -335,8 +339,17 @@ private:
         ScopedLocalRef<jobject> receiverObj(env, jniGetReferent(env, mReceiverWeakGlobal));
 
         ssize_t n;
-        ASensorEvent buffer[16];
-        while ((n = q->read(buffer, 16)) > 0) {
+        ASensorEvent buffer[kEventReadBatchSize];
+        if (!receiverObj.get()) {
+            // The Java queue is gone; the events still have to be drained and acked, but there is
+            // no one to dispatch them to.
+            while ((n = q->read(buffer, kEventReadBatchSize)) > 0) {
+                mSensorQueue->sendAck(buffer, n);
+            }
+            return 1;
+        }
+
+        while ((n = q->read(buffer, kEventReadBatchSize)) > 0) {
             for (int i=0 ; i<n ; i++) {
                 if (buffer[i].type == SENSOR_TYPE_STEP_COUNTER) {
                     // step-counter returns a uint64, but the java API only deals with floats
@@ -359,25 +372,21 @@ private:
                 if (buffer[i].type == SENSOR_TYPE_META_DATA) {
                     // This is a flush complete sensor event. Call dispatchFlushCompleteEvent
                     // method.
-                    if (receiverObj.get()) {
-                        env->CallVoidMethod(receiverObj.get(),
-                                            gBaseEventQueueClassInfo.dispatchFlushCompleteEvent,
-                                            buffer[i].meta_data.sensor);
-                    }
+                    env->CallVoidMethod(receiverObj.get(),
+                                        gBaseEventQueueClassInfo.dispatchFlushCompleteEvent,
+                                        buffer[i].meta_data.sensor);
                 } else if (buffer[i].type == SENSOR_TYPE_ADDITIONAL_INFO) {
                     // This is a flush complete sensor event. Call dispatchAdditionalInfoEvent
                     // method.
-                    if (receiverObj.get()) {
-                        int type = buffer[i].additional_info.type;
-                        int serial = buffer[i].additional_info.serial;
-                        env->CallVoidMethod(receiverObj.get(),
-                                            gBaseEventQueueClassInfo.dispatchAdditionalInfoEvent,
-                                            buffer[i].sensor,
-                                            type, serial,
-                                            mFloatScratch,
-                                            mIntScratch,
-                                            buffer[i].timestamp);
-                    }
+                    int type = buffer[i].additional_info.type;
+                    int serial = buffer[i].additional_info.serial;
+                    env->CallVoidMethod(receiverObj.get(),
+                                        gBaseEventQueueClassInfo.dispatchAdditionalInfoEvent,
+                                        buffer[i].sensor,
+                                        type, serial,
+                                        mFloatScratch,
+                                        mIntScratch,
+                                        buffer[i].timestamp);
                 }else {
                     int8_t status;
                     switch (buffer[i].type) {
@@ -396,14 +405,12 @@ private:
                         status = SENSOR_STATUS_ACCURACY_HIGH;
                         break;
                     }
-                    if (receiverObj.get()) {
-                        env->CallVoidMethod(receiverObj.get(),
-                                            gBaseEventQueueClassInfo.dispatchSensorEvent,
-                                            buffer[i].sensor,
-                                            mFloatScratch,
-                                            status,
-                                            buffer[i].timestamp);
-                    }
+                    env->CallVoidMethod(receiverObj.get(),
+                                        gBaseEventQueueClassInfo.dispatchSensorEvent,
+                                        buffer[i].sensor,
+                                        mFloatScratch,
+                                        status,
+                                        buffer[i].timestamp);
                 }
                 if (env->ExceptionCheck()) {
                     mSensorQueue->sendAck(buffer, n);
@@ -365,9 +365,10 @@ static jbyteArray CameraMetadata_readValues(JNIEnv *env, jclass thiz, jint tag,
     jbyteArray byteArray = env->NewByteArray(byteCount);
     if (env->ExceptionCheck()) return NULL;
 
-    // Copy into java array from native array
-    ScopedByteArrayRW arrayWriter(env, byteArray);
-    memcpy(arrayWriter.get(), entry.data.u8, byteCount);
+    // Copy into java array from native array. SetByteArrayRegion writes straight
+    // into the new array, rather than pinning it or copying it out and back.
+    env->SetByteArrayRegion(byteArray, 0, byteCount,
+                            reinterpret_cast<const jbyte*>(entry.data.u8));
 
     return byteArray;
 }
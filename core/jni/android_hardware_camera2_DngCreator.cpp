@@ -338,7 +338,7 @@ public:
     status_t close();
 private:
     enum {
-        BYTE_ARRAY_LENGTH = 4096
+        BYTE_ARRAY_LENGTH = 65536
     };
     jobject mOutputStream;
     JNIEnv* mEnv;
@@ -413,7 +413,7 @@ public:
     virtual ~JniInputStream();
 private:
     enum {
-        BYTE_ARRAY_LENGTH = 4096
+        BYTE_ARRAY_LENGTH = 65536
     };
     jobject mInStream;
     JNIEnv* mEnv;
@@ -500,7 +500,7 @@ public:
     virtual ~JniInputByteBuffer();
 private:
     enum {
-        BYTE_ARRAY_LENGTH = 4096
+        BYTE_ARRAY_LENGTH = 65536
     };
     jobject mInBuf;
     JNIEnv* mEnv;
@@ -712,7 +712,7 @@ protected:
     uint32_t mHeight;
     uint32_t mPixStride;
     uint32_t mRowStride;
-    uint16_t mOffset;
+    uint64_t mOffset;
     JNIEnv* mEnv;
     uint32_t mBytesPerSample;
     uint32_t mSamplesPerPixel;
@@ -31,6 +31,7 @@
 
 #include <iomanip>
 #include <string>
+#include <string_view>
 #include <vector>
 
 #include <android-base/logging.h>
@@ -251,11 +252,11 @@ static bool load_maps(int pid, stats_t* stats, bool* foundSwapPss)
         int which_heap = HEAP_UNKNOWN;
         int sub_heap = HEAP_UNKNOWN;
         bool is_swappable = false;
-        std::string name;
-        if (base::EndsWith(vma.name, " (deleted)")) {
-            name = vma.name.substr(0, vma.name.size() - strlen(" (deleted)"));
-        } else {
-            name = vma.name;
+        // Processes can have thousands of VMAs, so classify the name in place instead of
+        // copying it for every one.
+        std::string_view name = vma.name;
+        if (base::EndsWith(name, " (deleted)")) {
+            name.remove_suffix(strlen(" (deleted)"));
         }
 
         uint32_t namesz = name.size();
@@ -284,16 +285,16 @@ static bool load_maps(int pid, stats_t* stats, bool* foundSwapPss)
             which_heap = HEAP_TTF;
             is_swappable = true;
         } else if ((base::EndsWith(name, ".odex")) ||
-                (namesz > 4 && strstr(name.c_str(), ".dex") != nullptr)) {
+                (namesz > 4 && name.find(".dex") != std::string_view::npos)) {
             which_heap = HEAP_DEX;
             sub_heap = HEAP_DEX_APP_DEX;
             is_swappable = true;
         } else if (base::EndsWith(name, ".vdex")) {
             which_heap = HEAP_DEX;
             // Handle system@framework@boot and system/framework/boot|apex
-            if ((strstr(name.c_str(), "@boot") != nullptr) ||
-                    (strstr(name.c_str(), "/boot") != nullptr) ||
-                    (strstr(name.c_str(), "/apex") != nullptr)) {
+            if ((name.find("@boot") != std::string_view::npos) ||
+                    (name.find("/boot") != std::string_view::npos) ||
+                    (name.find("/apex") != std::string_view::npos)) {
                 sub_heap = HEAP_DEX_BOOT_VDEX;
             } else {
                 sub_heap = HEAP_DEX_APP_VDEX;
@@ -305,9 +306,9 @@ static bool load_maps(int pid, stats_t* stats, bool* foundSwapPss)
         } else if (base::EndsWith(name, ".art") || base::EndsWith(name, ".art]")) {
             which_heap = HEAP_ART;
             // Handle system@framework@boot* and system/framework/boot|apex*
-            if ((strstr(name.c_str(), "@boot") != nullptr) ||
-                    (strstr(name.c_str(), "/boot") != nullptr) ||
-                    (strstr(name.c_str(), "/apex") != nullptr)) {
+            if ((name.find("@boot") != std::string_view::npos) ||
+                    (name.find("/boot") != std::string_view::npos) ||
+                    (name.find("/apex") != std::string_view::npos)) {
                 sub_heap = HEAP_ART_BOOT;
             } else {
                 sub_heap = HEAP_ART_APP;
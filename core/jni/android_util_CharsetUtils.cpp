@@ -24,8 +24,9 @@ static jint android_util_CharsetUtils_toModifiedUtf8Bytes(JNIEnv *env, jobject c
     char *destPtr = reinterpret_cast<char*>(dest);
 
     // Quickly check if destination has plenty of room for worst-case
-    // 4-bytes-per-char encoded size
-    const size_t worstLen = (srcLen * 4);
+    // encoded size; modified UTF-8 never needs more than 3 bytes per UTF-16
+    // unit, since supplementary characters are encoded as two surrogates
+    const size_t worstLen = static_cast<size_t>(srcLen) * 3;
     if (destOff >= 0 && destOff + worstLen < destLen) {
         env->GetStringUTFRegion(src, 0, srcLen, destPtr + destOff);
         return strlen(destPtr + destOff + srcLen) + srcLen;
@@ -746,10 +746,10 @@ static void nativeSetColor(JNIEnv* env, jclass clazz, jlong transactionObj,
     auto transaction = reinterpret_cast<SurfaceComposerClient::Transaction*>(transactionObj);
     SurfaceControl* const ctrl = reinterpret_cast<SurfaceControl *>(nativeObject);
 
-    float* floatColors = env->GetFloatArrayElements(fColor, 0);
+    float floatColors[3];
+    env->GetFloatArrayRegion(fColor, 0, 3, floatColors);
     half3 color(floatColors[0], floatColors[1], floatColors[2]);
     transaction->setColor(ctrl, color);
-    env->ReleaseFloatArrayElements(fColor, floatColors, 0);
 }
 
 static void nativeSetMatrix(JNIEnv* env, jclass clazz, jlong transactionObj,
@@ -765,13 +765,13 @@ static void nativeSetColorTransform(JNIEnv* env, jclass clazz, jlong transaction
         jlong nativeObject, jfloatArray fMatrix, jfloatArray fTranslation) {
     auto transaction = reinterpret_cast<SurfaceComposerClient::Transaction*>(transactionObj);
     SurfaceControl* const surfaceControl = reinterpret_cast<SurfaceControl*>(nativeObject);
-    float* floatMatrix = env->GetFloatArrayElements(fMatrix, 0);
+    float floatMatrix[9];
+    env->GetFloatArrayRegion(fMatrix, 0, 9, floatMatrix);
     mat3 matrix(static_cast<float const*>(floatMatrix));
-    env->ReleaseFloatArrayElements(fMatrix, floatMatrix, 0);
 
-    float* floatTranslation = env->GetFloatArrayElements(fTranslation, 0);
+    float floatTranslation[3];
+    env->GetFloatArrayRegion(fTranslation, 0, 3, floatTranslation);
     vec3 translation(floatTranslation[0], floatTranslation[1], floatTranslation[2]);
-    env->ReleaseFloatArrayElements(fTranslation, floatTranslation, 0);
 
     transaction->setColorTransform(surfaceControl, matrix, translation);
 }
@@ -1684,15 +1684,15 @@ static void nativeSetGlobalShadowSettings(JNIEnv* env, jclass clazz, jfloatArray
         jfloatArray jSpotColor, jfloat lightPosY, jfloat lightPosZ, jfloat lightRadius) {
     sp<SurfaceComposerClient> client = SurfaceComposerClient::getDefault();
 
-    float* floatAmbientColor = env->GetFloatArrayElements(jAmbientColor, 0);
+    float floatAmbientColor[4];
+    env->GetFloatArrayRegion(jAmbientColor, 0, 4, floatAmbientColor);
     half4 ambientColor = half4(floatAmbientColor[0], floatAmbientColor[1], floatAmbientColor[2],
             floatAmbientColor[3]);
-    env->ReleaseFloatArrayElements(jAmbientColor, floatAmbientColor, 0);
 
-    float* floatSpotColor = env->GetFloatArrayElements(jSpotColor, 0);
+    float floatSpotColor[4];
+    env->GetFloatArrayRegion(jSpotColor, 0, 4, floatSpotColor);
     half4 spotColor = half4(floatSpotColor[0], floatSpotColor[1], floatSpotColor[2],
             floatSpotColor[3]);
-    env->ReleaseFloatArrayElements(jSpotColor, floatSpotColor, 0);
 
     client->setGlobalShadowSettings(ambientColor, spotColor, lightPosY, lightPosZ, lightRadius);
 }
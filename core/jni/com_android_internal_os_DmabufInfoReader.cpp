@@ -19,32 +19,37 @@
 
 namespace android {
 
+static struct {
+    jclass clazz;
+    jmethodID ctor;
+} gProcessDmabufClassInfo;
+
 static jobject DmabufInfoReader_getProcessStats(JNIEnv *env, jobject, jint pid) {
     std::vector<dmabufinfo::DmaBuffer> buffers;
     if (!dmabufinfo::ReadDmaBufMapRefs(pid, &buffers)) {
         return nullptr;
     }
-    jint mappedSize = 0;
+    // Sum in 64 bits: a process can map more than 2GB of buffers in total.
+    uint64_t mappedBytes = 0;
     jint mappedCount = buffers.size();
     for (const auto &buffer : buffers) {
-        mappedSize += buffer.size();
+        mappedBytes += buffer.size();
     }
-    mappedSize /= 1024;
+    jint mappedSize = mappedBytes / 1024;
 
     jint retainedSize = -1;
     jint retainedCount = -1;
     if (dmabufinfo::ReadDmaBufFdRefs(pid, &buffers)) {
         retainedCount = buffers.size();
-        retainedSize = 0;
+        uint64_t retainedBytes = 0;
         for (const auto &buffer : buffers) {
-            retainedSize += buffer.size();
+            retainedBytes += buffer.size();
         }
-        retainedSize /= 1024;
+        retainedSize = retainedBytes / 1024;
     }
 
-    jclass clazz = FindClassOrDie(env, "com/android/internal/os/DmabufInfoReader$ProcessDmabuf");
-    jmethodID constructID = GetMethodIDOrDie(env, clazz, "<init>", "(IIII)V");
-    return env->NewObject(clazz, constructID, retainedSize, retainedCount, mappedSize, mappedCount);
+    return env->NewObject(gProcessDmabufClassInfo.clazz, gProcessDmabufClassInfo.ctor,
+                          retainedSize, retainedCount, mappedSize, mappedCount);
 }
 
 static const JNINativeMethod methods[] = {
@@ -53,6 +58,10 @@ static const JNINativeMethod methods[] = {
 };
 
 int register_com_android_internal_os_DmabufInfoReader(JNIEnv *env) {
+    jclass clazz = FindClassOrDie(env, "com/android/internal/os/DmabufInfoReader$ProcessDmabuf");
+    gProcessDmabufClassInfo.clazz = MakeGlobalRefOrDie(env, clazz);
+    gProcessDmabufClassInfo.ctor = GetMethodIDOrDie(env, clazz, "<init>", "(IIII)V");
+
     return RegisterMethodsOrDie(env, "com/android/internal/os/DmabufInfoReader", methods,
                                 NELEM(methods));
 }
@@ -77,6 +77,8 @@ static jboolean KernelCpuUidFreqTimeBpfMapReader_readBpfData(JNIEnv *env, jobjec
         jlongArray ar = getUidArray(env, sparseAr, uid, s);
         if (ar == nullptr) return false;
         copy2DVecToArray(env, ar, times);
+        // One array per updated uid; don't let them pile up in the local reference table.
+        env->DeleteLocalRef(ar);
     }
     lastUpdate = newLastUpdate;
     return true;
@@ -102,6 +104,7 @@ static jboolean KernelCpuUidActiveTimeBpfMapReader_readBpfData(JNIEnv *env, jobj
         if (ar == nullptr) return false;
         env->SetLongArrayRegion(ar, 0, times.active.size(),
                                 reinterpret_cast<const jlong *>(times.active.data()));
+        env->DeleteLocalRef(ar);
     }
     lastUpdate = newLastUpdate;
     return true;
@@ -136,6 +139,7 @@ static jboolean KernelCpuUidClusterTimeBpfMapReader_readBpfData(JNIEnv *env, job
         jlongArray ar = getUidArray(env, sparseAr, uid, s);
         if (ar == nullptr) return false;
         copy2DVecToArray(env, ar, times.policy);
+        env->DeleteLocalRef(ar);
     }
     lastUpdate = newLastUpdate;
     return true;
@@ -37,6 +37,7 @@
 #include <sstream>
 #include <string>
 #include <string_view>
+#include <unordered_map>
 #include <unordered_set>
 
 #include <android/fdsan.h>
@@ -71,6 +72,7 @@
 #include <android-base/properties.h>
 #include <android-base/stringprintf.h>
 #include <android-base/unique_fd.h>
+#include <androidfw/AssetsProvider.h>
 #include <bionic/malloc.h>
 #include <bionic/mte.h>
 #include <cutils/fs.h>
@@ -636,6 +638,10 @@ static void PreApplicationInit() {
   // Set the jemalloc decay time to 1.
   mallopt(M_DECAY_TIME, 1);
 
+  // The inflated asset cache holds ashmem file descriptors, so it is left off in the zygote, where
+  // any of them still open at fork would fail the file descriptor allowlist check.
+  android::ZipAssetsProvider::SetInflatedAssetCacheEnabled(true);
+
   void *mBelugaHandle = nullptr;
   void (*mBeluga)() = nullptr;
   mBelugaHandle = dlopen("libbeluga.so", RTLD_NOW);
@@ -1091,10 +1097,15 @@ static void mountAppData(std::string_view package_name,
   BindMount(mirrorAppDataPath, actualAppDataPath, fail_fn);
 }
 
+// Names of the entries of a CE data directory keyed by inode, per directory path. While CE storage
+// is locked the names are encrypted and packages have to be found by inode, so isolateAppData
+// reads each directory once instead of once per package.
+using CeDirNamesByInode = std::unordered_map<std::string, std::unordered_map<ino_t, std::string>>;
+
 // Get the directory name stored in /data/data. If device is unlocked it should be the same as
 // package name, otherwise it will be an encrypted name but with same inode number.
 static std::string getAppDataDirName(std::string_view parent_path, std::string_view package_name,
-      long long ce_data_inode, fail_fn_t fail_fn) {
+      long long ce_data_inode, fail_fn_t fail_fn, CeDirNamesByInode* dir_names = nullptr) {
   // Check if directory exists
   char tmpPath[PATH_MAX];
   snprintf(tmpPath, PATH_MAX, "%s/%s", parent_path.data(), package_name.data());
@@ -1108,7 +1119,24 @@ static std::string getAppDataDirName(std::string_view parent_path, std::string_v
       fail_fn(CREATE_ERROR("Unexpected error in getAppDataDirName: %s", strerror(errno)));
       return nullptr;
     }
-    {
+    if (dir_names != nullptr) {
+      // Directory doesn't exist, look the name up by inode.
+      auto [names, inserted] = dir_names->try_emplace(std::string(parent_path));
+      if (inserted) {
+        std::unique_ptr<DIR, decltype(&closedir)> dir(opendir(parent_path.data()), closedir);
+        if (dir == nullptr) {
+          fail_fn(CREATE_ERROR("Failed to opendir %s", parent_path.data()));
+        }
+        struct dirent* ent;
+        while ((ent = readdir(dir.get()))) {
+          names->second.emplace(ent->d_ino, ent->d_name);
+        }
+      }
+      auto name = names->second.find(static_cast<ino_t>(ce_data_inode));
+      if (name != names->second.end()) {
+        return name->second;
+      }
+    } else {
       // Directory doesn't exist, try to search the name from inode
       std::unique_ptr<DIR, decltype(&closedir)> dir(opendir(parent_path.data()), closedir);
       if (dir == nullptr) {
@@ -1156,7 +1184,7 @@ static std::string getAppDataDirName(std::string_view parent_path, std::string_v
 // and create and bind mount app data in related_packages.
 static void isolateAppDataPerPackage(int userId, std::string_view package_name,
     std::string_view volume_uuid, long long ce_data_inode, std::string_view actualCePath,
-    std::string_view actualDePath, fail_fn_t fail_fn) {
+    std::string_view actualDePath, CeDirNamesByInode* ce_dir_names, fail_fn_t fail_fn) {
 
   char mirrorCePath[PATH_MAX];
   char mirrorDePath[PATH_MAX];
@@ -1168,11 +1196,13 @@ static void isolateAppDataPerPackage(int userId, std::string_view package_name,
   createAndMountAppData(package_name, package_name, mirrorDePath, actualDePath, fail_fn,
                         true /*call_fail_fn*/);
 
-  std::string ce_data_path = getAppDataDirName(mirrorCePath, package_name, ce_data_inode, fail_fn);
+  std::string ce_data_path =
+      getAppDataDirName(mirrorCePath, package_name, ce_data_inode, fail_fn, ce_dir_names);
   if (!createAndMountAppData(package_name, ce_data_path, mirrorCePath, actualCePath, fail_fn,
                              false /*call_fail_fn*/)) {
     // CE might unlocks and the name is decrypted
     // get the name and mount again
+    ce_dir_names->clear();
     ce_data_path=getAppDataDirName(mirrorCePath, package_name, ce_data_inode, fail_fn);
     mountAppData(package_name, ce_data_path, mirrorCePath, actualCePath, fail_fn);
   }
@@ -1298,6 +1328,7 @@ static void isolateAppData(JNIEnv* env, const std::vector<std::string>& merged_d
   PrepareDirIfNotPresent("/data/user_de/0", DEFAULT_DATA_DIR_PERMISSION,
       AID_ROOT, AID_ROOT, fail_fn);
 
+  CeDirNamesByInode ceDirNames;
   for (int i = 0; i < size; i += 3) {
     std::string const & packageName = merged_data_info_list[i];
     std::string const & volUuid  = merged_data_info_list[i + 1];
@@ -1350,7 +1381,7 @@ static void isolateAppData(JNIEnv* env, const std::vector<std::string>& merged_d
       actualDePath = internalDeUserPath;
     }
     isolateAppDataPerPackage(userId, packageName, volUuid, ceDataInode,
-        actualCePath, actualDePath, fail_fn);
+        actualCePath, actualDePath, &ceDirNames, fail_fn);
   }
   // We set the label AFTER everything is done, as we are applying
   // the file operations on tmpfs. If we set the label when we mount
@@ -16,6 +16,10 @@
 
 #include "androidfw/ApkAssets.h"
 
+#include <algorithm>
+#include <atomic>
+#include <thread>
+
 #include "android-base/errors.h"
 #include "android-base/logging.h"
 
@@ -43,6 +47,30 @@ std::unique_ptr<ApkAssets> ApkAssets::Load(const std::string& path, package_prop
   return Load(ZipAssetsProvider::Create(path, flags), flags);
 }
 
+std::vector<std::unique_ptr<ApkAssets>> ApkAssets::LoadAll(const std::vector<std::string>& paths,
+                                                           package_property_t flags,
+                                                           size_t max_threads) {
+  std::vector<std::unique_ptr<ApkAssets>> apk_assets(paths.size());
+  std::atomic<size_t> next_index = 0U;
+  auto load_next = [&]() {
+    for (size_t i = next_index++; i < paths.size(); i = next_index++) {
+      apk_assets[i] = Load(paths[i], flags);
+    }
+  };
+
+  // The calling thread loads APKs too, so only spawn the remaining workers.
+  const size_t thread_count = std::min(std::max<size_t>(max_threads, 1U), paths.size());
+  std::vector<std::thread> workers;
+  for (size_t i = 1; i < thread_count; i++) {
+    workers.emplace_back(load_next);
+  }
+  load_next();
+  for (std::thread& worker : workers) {
+    worker.join();
+  }
+  return apk_assets;
+}
+
 std::unique_ptr<ApkAssets> ApkAssets::LoadFromFd(base::unique_fd fd,
                                                  const std::string& debug_name,
                                                  package_property_t flags,
@@ -19,6 +19,7 @@
 #include "androidfw/AssetManager2.h"
 
 #include <algorithm>
+#include <cinttypes>
 #include <iterator>
 #include <map>
 #include <set>
@@ -66,37 +67,21 @@ base::expected<EntryValue, IOError> GetEntryValue(
   return value;
 }
 
-} // namespace
-
-struct FindEntryResult {
-  // The cookie representing the ApkAssets in which the value resides.
-  ApkAssetsCookie cookie;
-
-  // The value of the resource table entry. Either an android::Res_value for non-bag types or an
-  // incfs::verified_map_ptr<ResTable_map_entry> for bag types.
-  EntryValue entry;
-
-  // The configuration for which the resulting entry was defined. This is already swapped to host
-  // endianness.
-  ResTable_config config;
-
-  // The bitmask of configuration axis with which the resource value varies.
-  uint32_t type_flags;
-
-  // The dynamic package ID map for the package from which this resource came from.
-  const DynamicRefTable* dynamic_ref_table;
-
-  // The package name of the resource.
-  const std::string* package_name;
-
-  // The string pool reference to the type's name. This uses a different string pool than
-  // the global string pool, but this is hidden from the caller.
-  StringPoolRef type_string_ref;
+// The maximum number of FindEntry() results kept in AssetManager2::cached_entries_. Each result
+// holds a full ResTable_config, and a process has many AssetManagers, so this only covers the
+// resources that are resolved repeatedly while inflating a screen rather than everything an app
+// has ever looked up. The hit and miss counts in DumpToLog show whether it is large enough.
+constexpr size_t kMaxCachedEntries = 256U;
+
+uint64_t MakeEntryCacheKey(uint32_t resid, uint16_t density_override, bool stop_at_first_match,
+                           bool ignore_configuration) {
+  return static_cast<uint64_t>(resid) |
+         (static_cast<uint64_t>(density_override) << 32U) |
+         (static_cast<uint64_t>(stop_at_first_match) << 48U) |
+         (static_cast<uint64_t>(ignore_configuration) << 49U);
+}
 
-  // The string pool reference to the entry's name. This uses a different string pool than
-  // the global string pool, but this is hidden from the caller.
-  StringPoolRef entry_string_ref;
-};
+} // namespace
 
 AssetManager2::AssetManager2() {
   memset(&configuration_, 0, sizeof(configuration_));
@@ -252,13 +237,19 @@ void AssetManager2::DumpToLog() const {
   }
   LOG(INFO) << "Package ID map: " << list;
 
+  LOG(INFO) << base::StringPrintf("Entry cache: size=%zu hits=%" PRIu64 " misses=%" PRIu64,
+                                  cached_entries_.size(), cached_entries_hits_,
+                                  cached_entries_misses_);
+
   for (const auto& package_group: package_groups_) {
     list = "";
     for (const auto& package : package_group.packages_) {
       const LoadedPackage* loaded_package = package.loaded_package_;
-      base::StringAppendF(&list, "%s(%02x%s), ", loaded_package->GetPackageName().c_str(),
+      base::StringAppendF(&list, "%s(%02x%s, indexed names=%zu), ",
+                          loaded_package->GetPackageName().c_str(),
                           loaded_package->GetPackageId(),
-                          (loaded_package->IsDynamic() ? " dynamic" : ""));
+                          (loaded_package->IsDynamic() ? " dynamic" : ""),
+                          loaded_package->GetEntryNameIndexSize());
     }
     LOG(INFO) << base::StringPrintf("PG (%02x): ",
                                     package_group.dynamic_ref_table->mAssignedPackageId)
@@ -566,6 +557,21 @@ base::expected<FindEntryResult, NullOrIOError> AssetManager2::FindEntry(
     last_resolution_.resid = resid;
   }
 
+  // The resolution steps are only recorded when the entry is searched for, so bypass the cache
+  // while logging is enabled.
+  const uint64_t cache_key = MakeEntryCacheKey(resid, density_override, stop_at_first_match,
+                                               ignore_configuration);
+  if (!logging_enabled) {
+    if (auto cached_iter = cached_entry_slots_.find(cache_key);
+        cached_iter != cached_entry_slots_.end()) {
+      cached_entries_hits_++;
+      CachedEntry& cached_entry = cached_entries_[cached_iter->second];
+      cached_entry.referenced = true;
+      return cached_entry.result;
+    }
+    cached_entries_misses_++;
+  }
+
   // Might use this if density_override != 0.
   ResTable_config density_override_config;
 
@@ -656,9 +662,36 @@ base::expected<FindEntryResult, NullOrIOError> AssetManager2::FindEntry(
     last_resolution_.entry_string_ref = result->entry_string_ref;
   }
 
+  CacheEntry(cache_key, *result);
   return result;
 }
 
+void AssetManager2::CacheEntry(uint64_t cache_key, const FindEntryResult& result) const {
+  if (auto slot = cached_entry_slots_.find(cache_key); slot != cached_entry_slots_.end()) {
+    // Lookups bypass the cache while resolution logging is enabled, so the key may already be in it.
+    cached_entries_[slot->second].result = result;
+    return;
+  }
+
+  if (cached_entries_.size() < kMaxCachedEntries) {
+    cached_entry_slots_.emplace(cache_key, cached_entries_.size());
+    cached_entries_.push_back(CachedEntry{cache_key, result, false /* referenced */});
+    return;
+  }
+
+  // Evict with the clock algorithm: skip over, and clear, entries that were hit since the hand
+  // last passed them, and replace the first one that was not.
+  while (cached_entries_[cached_entries_hand_].referenced) {
+    cached_entries_[cached_entries_hand_].referenced = false;
+    cached_entries_hand_ = (cached_entries_hand_ + 1U) % cached_entries_.size();
+  }
+  CachedEntry& victim = cached_entries_[cached_entries_hand_];
+  cached_entry_slots_.erase(victim.key);
+  cached_entry_slots_.emplace(cache_key, cached_entries_hand_);
+  victim = CachedEntry{cache_key, result, false /* referenced */};
+  cached_entries_hand_ = (cached_entries_hand_ + 1U) % cached_entries_.size();
+}
+
 base::expected<FindEntryResult, NullOrIOError> AssetManager2::FindEntryInternal(
     const PackageGroup& package_group, uint8_t type_idx, uint16_t entry_idx,
     const ResTable_config& desired_config, bool stop_at_first_match,
@@ -711,7 +744,8 @@ base::expected<FindEntryResult, NullOrIOError> AssetManager2::FindEntryInternal(
       // We can skip calling ResTable_config::match() if the caller does not care for the
       // configuration to match or if we're using the list of types that have already had their
       // configuration matched.
-      const ResTable_config& this_config = type_entry->config;
+      const ResTable_config& this_config = (use_filtered) ? filtered_group.configs[i]
+                                                          : type_entry->config;
       if (!(use_filtered || ignore_configuration || this_config.match(desired_config))) {
         continue;
       }
@@ -997,6 +1031,11 @@ base::expected<const ResolvedBag*, NullOrIOError> AssetManager2::ResolveBag(
 }
 
 base::expected<const ResolvedBag*, NullOrIOError> AssetManager2::GetBag(uint32_t resid) const {
+  // Avoid recording a bag stack (and allocating a map node) when the bag is already resolved.
+  if (auto cached_iter = cached_bags_.find(resid); cached_iter != cached_bags_.end()) {
+    return cached_iter->second.get();
+  }
+
   std::vector<uint32_t> found_resids;
   const auto bag = GetBag(resid, found_resids);
   cached_bag_resid_stacks_.emplace(resid, found_resids);
@@ -1290,6 +1329,11 @@ base::expected<uint32_t, NullOrIOError> AssetManager2::GetResourceId(
 }
 
 void AssetManager2::RebuildFilterList() {
+  // Cached entries refer to the previous package groups and configuration.
+  cached_entries_.clear();
+  cached_entry_slots_.clear();
+  cached_entries_hand_ = 0U;
+
   for (PackageGroup& group : package_groups_) {
     for (ConfiguredPackage& impl : group.packages_) {
       // Destroy it.
@@ -1304,6 +1348,7 @@ void AssetManager2::RebuildFilterList() {
         for (const auto& type_entry : type_spec.type_entries) {
           if (type_entry.config.match(configuration_)) {
             group.type_entries.push_back(&type_entry);
+            group.configs.push_back(type_entry.config);
           }
         }
       });
@@ -1382,13 +1427,25 @@ base::expected<std::monostate, NullOrIOError> Theme::ApplyStyle(uint32_t resid,
   // Merge the flags from this style.
   type_spec_flags_ |= (*bag)->type_spec_flags;
 
+  // Both the theme entries and the bag entries are sorted by attribute resource id, so the style
+  // is applied as a single merge of the two sorted runs rather than one binary search and
+  // insertion per attribute. The merge buffer is swapped with entries_ afterwards, so the two
+  // allocations are reused across calls instead of allocating a new vector per style.
+  static thread_local std::vector<Entry> merged;
+  merged.clear();
+  merged.reserve(entries_.size() + (*bag)->entry_count);
+  auto entry_it = entries_.begin();
+  const auto entry_end = entries_.end();
+  bool is_valid_style = true;
+
   for (auto it = begin(*bag); it != end(*bag); ++it) {
     const uint32_t attr_res_id = it->key;
 
     // If the resource ID passed in is not a style, the key can be some other identifier that is not
     // a resource ID. We should fail fast instead of operating with strange resource IDs.
     if (!is_valid_resid(attr_res_id)) {
-      return base::unexpected(std::nullopt);
+      is_valid_style = false;
+      break;
     }
 
     // DATA_NULL_EMPTY (@empty) is a valid resource value and DATA_NULL_UNDEFINED represents
@@ -1399,21 +1456,39 @@ base::expected<std::monostate, NullOrIOError> Theme::ApplyStyle(uint32_t resid,
       continue;
     }
 
+    // Copy the existing attributes that precede this one.
+    for (; entry_it != entry_end && entry_it->attr_res_id < attr_res_id; ++entry_it) {
+      merged.push_back(*entry_it);
+    }
+
     Theme::Entry new_entry{attr_res_id, it->cookie, (*bag)->type_spec_flags, it->value};
-    auto entry_it = std::lower_bound(entries_.begin(), entries_.end(), attr_res_id,
-                                     ThemeEntryKeyComparer{});
-    if (entry_it != entries_.end() && entry_it->attr_res_id == attr_res_id) {
+    if (entry_it != entry_end && entry_it->attr_res_id == attr_res_id) {
       if (is_undefined) {
         // DATA_NULL_UNDEFINED clears the value of the attribute in the theme only when `force` is
         /// true.
-        entries_.erase(entry_it);
+        ++entry_it;
+      } else if (force) {
+        merged.push_back(new_entry);
+        ++entry_it;
+      }
+    } else if (!merged.empty() && merged.back().attr_res_id == attr_res_id) {
+      // The bag defines the attribute more than once.
+      if (is_undefined) {
+        merged.pop_back();
       } else if (force) {
-        *entry_it = new_entry;
+        merged.back() = new_entry;
       }
     } else {
-      entries_.insert(entry_it, new_entry);
+      merged.push_back(new_entry);
     }
   }
+
+  merged.insert(merged.end(), entry_it, entry_end);
+  entries_.swap(merged);
+  merged.clear();
+  if (!is_valid_style) {
+    return base::unexpected(std::nullopt);
+  }
   return {};
 }
 
@@ -17,17 +17,319 @@
 #include "androidfw/AssetsProvider.h"
 
 #include <sys/stat.h>
+#ifndef _WIN32
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <list>
+#include <mutex>
 
 #include <android-base/errors.h>
 #include <android-base/stringprintf.h>
 #include <android-base/utf8.h>
+#include <androidfw/ZipUtils.h>
 #include <ziparchive/zip_archive.h>
+#ifdef __ANDROID__
+#include <cutils/ashmem.h>
+#endif
 
 namespace android {
 namespace {
 constexpr const char* kEmptyDebugString = "<empty>";
+
+// Tells the kernel how the pages of an uncompressed asset that is served directly from the APK
+// mapping will be accessed. Buffered and streamed assets are read from start to end, so their
+// pages can be read ahead instead of being faulted in one at a time.
+void AdviseAssetMap(const incfs::IncFsFileMap& map, Asset::AccessMode mode) {
+#ifndef _WIN32
+  int advice;
+  switch (mode) {
+    case Asset::ACCESS_BUFFER:
+      advice = MADV_WILLNEED;
+      break;
+    case Asset::ACCESS_STREAMING:
+      advice = MADV_SEQUENTIAL;
+      break;
+    default:
+      return;
+  }
+
+  static const uintptr_t kPageSize = static_cast<uintptr_t>(sysconf(_SC_PAGESIZE));
+  const uintptr_t start = reinterpret_cast<uintptr_t>(map.data().unsafe_ptr());
+  const uintptr_t aligned_start = start & ~(kPageSize - 1U);
+  const size_t length = map.length() + (start - aligned_start);
+  // The advice is only an optimization, so failures are ignored.
+  madvise(reinterpret_cast<void*>(aligned_start), length, advice);
+#else
+  (void)map;
+  (void)mode;
+#endif
+}
+
+#ifdef __ANDROID__
+// Limits of the inflated asset cache, shared by every APK of the process so that the number of
+// ashmem file descriptors and bytes it holds is bounded. Entries smaller than a page are cheap to
+// inflate again and are not worth an ashmem region each; large entries would evict everything else.
+constexpr size_t kInflatedCacheMaxBytes = 2U * 1024U * 1024U;
+constexpr size_t kInflatedCacheMaxEntries = 8U;
+constexpr size_t kInflatedCacheMinAssetSize = 4U * 1024U;
+constexpr size_t kInflatedCacheMaxAssetSize = 1024U * 1024U;
+
+// The inflated contents of a compressed zip entry in an ashmem region. The region stays pinned
+// while an asset reads from it and is unpinned otherwise, so the kernel may purge it under memory
+// pressure instead of it counting against the process.
+class InflatedData {
+ public:
+  static std::shared_ptr<InflatedData> Inflate(const std::string& path,
+                                               const incfs::IncFsFileMap& compressed,
+                                               size_t uncompressed_length) {
+    base::unique_fd fd(ashmem_create_region(path.c_str(), uncompressed_length));
+    if (!fd.ok()) {
+      return {};
+    }
+    void* data = mmap(nullptr, uncompressed_length, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (data == MAP_FAILED) {
+      return {};
+    }
+    // A new region starts out pinned, which matches the single reader it is returned to.
+    auto inflated = std::shared_ptr<InflatedData>(
+        new InflatedData(std::move(fd), data, uncompressed_length));
+    if (!ZipUtils::inflateToBuffer(compressed.data(), data, uncompressed_length,
+                                   compressed.length()) ||
+        mprotect(data, uncompressed_length, PROT_READ) != 0) {
+      return {};
+    }
+    return inflated;
+  }
+
+  ~InflatedData() {
+    munmap(data_, length_);
+  }
+
+  // Pins the region for a new reader. Returns false if the kernel purged it while it was unpinned,
+  // in which case the contents are gone and the region must not be used.
+  bool Acquire() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (readers_ == 0 && ashmem_pin_region(fd_, 0, 0) == ASHMEM_WAS_PURGED) {
+      ashmem_unpin_region(fd_, 0, 0);
+      return false;
+    }
+    ++readers_;
+    return true;
+  }
+
+  void Release() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (--readers_ == 0) {
+      ashmem_unpin_region(fd_, 0, 0);
+    }
+  }
+
+  const void* data() const {
+    return data_;
+  }
+
+  size_t length() const {
+    return length_;
+  }
+
+ private:
+  InflatedData(base::unique_fd fd, void* data, size_t length)
+      : fd_(std::move(fd)), data_(data), length_(length) {}
+
+  base::unique_fd fd_;
+  void* data_;
+  size_t length_;
+  std::mutex mutex_;
+  size_t readers_ = 1U;
+
+  DISALLOW_COPY_AND_ASSIGN(InflatedData);
+};
+
+// An asset that reads from cached inflated data, keeping its region pinned until it is closed.
+class CachedAsset : public Asset {
+ public:
+  explicit CachedAsset(std::shared_ptr<InflatedData> data) : data_(std::move(data)) {
+    registerAsset(this);
+  }
+
+  ~CachedAsset() override {
+    close();
+    unregisterAsset(this);
+  }
+
+  ssize_t read(void* buf, size_t count) override {
+    if (data_ == nullptr) {
+      return -1;
+    }
+    const size_t remaining = data_->length() - offset_;
+    count = std::min(count, remaining);
+    memcpy(buf, static_cast<const uint8_t*>(data_->data()) + offset_, count);
+    offset_ += count;
+    return static_cast<ssize_t>(count);
+  }
+
+  off64_t seek(off64_t offset, int whence) override {
+    if (data_ == nullptr) {
+      return -1;
+    }
+    const off64_t new_offset = handleSeek(offset, whence, offset_, data_->length());
+    if (new_offset != -1) {
+      offset_ = new_offset;
+    }
+    return new_offset;
+  }
+
+  void close() override {
+    if (data_ != nullptr) {
+      data_->Release();
+      data_.reset();
+    }
+  }
+
+  const void* getBuffer(bool /* aligned */) override {
+    return data_ != nullptr ? data_->data() : nullptr;
+  }
+
+  incfs::map_ptr<void> getIncFsBuffer(bool aligned) override {
+    return incfs::map_ptr<void>(getBuffer(aligned));
+  }
+
+  off64_t getLength() const override {
+    return data_ != nullptr ? data_->length() : 0;
+  }
+
+  off64_t getRemainingLength() const override {
+    return getLength() - offset_;
+  }
+
+  int openFileDescriptor(off64_t* /* outStart */, off64_t* /* outLength */) const override {
+    return -1;
+  }
+
+ private:
+  std::shared_ptr<InflatedData> data_;
+  off64_t offset_ = 0;
+};
+
+// Recently inflated compressed entries opened with ACCESS_BUFFER, kept in purgeable ashmem so that
+// reopening them does not inflate them again. Disabled until SetInflatedAssetCacheEnabled(true).
+class InflatedAssetCache {
+ public:
+  static InflatedAssetCache& Get() {
+    static InflatedAssetCache* cache = new InflatedAssetCache();
+    return *cache;
+  }
+
+  bool ShouldCache(const ZipEntry& entry, Asset::AccessMode mode) const {
+    return enabled_.load(std::memory_order_relaxed) && mode == Asset::ACCESS_BUFFER &&
+           entry.uncompressed_length >= kInflatedCacheMinAssetSize &&
+           entry.uncompressed_length <= kInflatedCacheMaxAssetSize;
+  }
+
+  void SetEnabled(bool enabled) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    enabled_ = enabled;
+    if (!enabled) {
+      entries_.clear();
+      total_bytes_ = 0U;
+    }
+  }
+
+  std::unique_ptr<Asset> Open(const ZipAssetsProvider* owner, const std::string& path) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto iter = Find(owner, path);
+    if (iter == entries_.end()) {
+      return {};
+    }
+    std::shared_ptr<InflatedData> data = iter->data;
+    if (!data->Acquire()) {
+      total_bytes_ -= data->length();
+      entries_.erase(iter);
+      return {};
+    }
+    entries_.splice(entries_.begin(), entries_, iter);
+    return std::make_unique<CachedAsset>(std::move(data));
+  }
+
+  std::unique_ptr<Asset> Insert(const ZipAssetsProvider* owner, const std::string& path,
+                                const incfs::IncFsFileMap& compressed,
+                                size_t uncompressed_length) {
+    // Inflate without holding the lock so that other assets can still be opened.
+    std::shared_ptr<InflatedData> data =
+        InflatedData::Inflate(path, compressed, uncompressed_length);
+    if (data == nullptr) {
+      return {};
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!enabled_) {
+      return std::make_unique<CachedAsset>(std::move(data));
+    }
+    if (auto existing = Find(owner, path); existing != entries_.end()) {
+      total_bytes_ -= existing->data->length();
+      entries_.erase(existing);
+    }
+    entries_.push_front(Entry{owner, path, data});
+    total_bytes_ += data->length();
+    while (total_bytes_ > kInflatedCacheMaxBytes || entries_.size() > kInflatedCacheMaxEntries) {
+      // Assets still reading an evicted region keep it alive until they are closed.
+      total_bytes_ -= entries_.back().data->length();
+      entries_.pop_back();
+    }
+    return std::make_unique<CachedAsset>(std::move(data));
+  }
+
+  // Drops the entries of a provider that is being destroyed.
+  void RemoveAll(const ZipAssetsProvider* owner) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (auto iter = entries_.begin(); iter != entries_.end();) {
+      if (iter->owner == owner) {
+        total_bytes_ -= iter->data->length();
+        iter = entries_.erase(iter);
+      } else {
+        ++iter;
+      }
+    }
+  }
+
+ private:
+  struct Entry {
+    const ZipAssetsProvider* owner;
+    std::string path;
+    std::shared_ptr<InflatedData> data;
+  };
+
+  InflatedAssetCache() = default;
+
+  std::list<Entry>::iterator Find(const ZipAssetsProvider* owner, const std::string& path) {
+    return std::find_if(entries_.begin(), entries_.end(), [&](const Entry& entry) {
+      return entry.owner == owner && entry.path == path;
+    });
+  }
+
+  std::atomic<bool> enabled_{false};
+  std::mutex mutex_;
+
+  // Most recently used entries are at the front of the list.
+  std::list<Entry> entries_;
+  size_t total_bytes_ = 0U;
+};
+#endif
 } // namespace
 
+void ZipAssetsProvider::SetInflatedAssetCacheEnabled(bool enabled) {
+#ifdef __ANDROID__
+  InflatedAssetCache::Get().SetEnabled(enabled);
+#else
+  (void)enabled;
+#endif
+}
+
 std::unique_ptr<Asset> AssetsProvider::Open(const std::string& path, Asset::AccessMode mode,
                                             bool* file_exists) const {
   return OpenInternal(path, mode, file_exists);
@@ -91,6 +393,12 @@ ZipAssetsProvider::ZipAssetsProvider(ZipArchiveHandle handle, PathOrDebugName&&
       flags_(flags),
       last_mod_time_(last_mod_time) {}
 
+ZipAssetsProvider::~ZipAssetsProvider() {
+#ifdef __ANDROID__
+  InflatedAssetCache::Get().RemoveAll(this);
+#endif
+}
+
 std::unique_ptr<ZipAssetsProvider> ZipAssetsProvider::Create(std::string path,
                                                              package_property_t flags) {
   ZipArchiveHandle handle;
@@ -167,6 +475,15 @@ std::unique_ptr<Asset> ZipAssetsProvider::OpenInternal(const std::string& path,
     const bool incremental_hardening = (flags_ & PROPERTY_DISABLE_INCREMENTAL_HARDENING) == 0U;
     incfs::IncFsFileMap asset_map;
     if (entry.method == kCompressDeflated) {
+#ifdef __ANDROID__
+      InflatedAssetCache& inflated_cache = InflatedAssetCache::Get();
+      const bool use_cache = inflated_cache.ShouldCache(entry, mode);
+      if (use_cache) {
+        if (auto asset = inflated_cache.Open(this, path)) {
+          return asset;
+        }
+      }
+#endif
       if (!asset_map.Create(fd, entry.offset + fd_offset, entry.compressed_length,
                             name_.GetDebugName().c_str(), incremental_hardening)) {
         LOG(ERROR) << "Failed to mmap file '" << path << "' in APK '" << name_.GetDebugName()
@@ -174,6 +491,14 @@ std::unique_ptr<Asset> ZipAssetsProvider::OpenInternal(const std::string& path,
         return {};
       }
 
+#ifdef __ANDROID__
+      if (use_cache) {
+        if (auto asset = inflated_cache.Insert(this, path, asset_map,
+                                               entry.uncompressed_length)) {
+          return asset;
+        }
+      }
+#endif
       std::unique_ptr<Asset> asset =
           Asset::createFromCompressedMap(std::move(asset_map), entry.uncompressed_length, mode);
       if (asset == nullptr) {
@@ -189,6 +514,7 @@ std::unique_ptr<Asset> ZipAssetsProvider::OpenInternal(const std::string& path,
       LOG(ERROR) << "Failed to mmap file '" << path << "' in APK '" << name_.GetDebugName() << "'";
       return {};
     }
+    AdviseAssetMap(asset_map, mode);
 
     base::unique_fd ufd;
     if (name_.GetPath() == nullptr) {
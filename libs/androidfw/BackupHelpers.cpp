@@ -37,6 +37,16 @@
 
 namespace android {
 
+// Buffer size used when streaming file contents to back up.  Backup
+// files are read once front to back, so fewer, larger reads win.
+static const int kFileBufferSize = 64*1024;
+
+// Buffer size used by compute_crc32.  Hashing only keeps one buffer alive at a
+// time, so it can afford larger reads than the backup writers.  Reads are used
+// instead of mmap so a file truncated while it is hashed only ends the read
+// early rather than raising SIGBUS.
+static const int kCrcBufferSize = 256*1024;
+
 #define MAGIC0 0x70616e53 // Snap
 #define MAGIC1 0x656c6946 // File
 
@@ -213,7 +223,7 @@ write_update_file(BackupDataWriter* dataStream, int fd, int mode, const String8&
 {
     LOGP("write_update_file %s (%s) : mode 0%o\n", realFilename, key.string(), mode);
 
-    const int bufsize = 4*1024;
+    const int bufsize = kFileBufferSize;
     int err;
     int amt;
     int fileSize;
@@ -224,6 +234,7 @@ write_update_file(BackupDataWriter* dataStream, int fd, int mode, const String8&
 
     fileSize = lseek(fd, 0, SEEK_END);
     lseek(fd, 0, SEEK_SET);
+    posix_fadvise(fd, 0, 0, POSIX_FADV_SEQUENTIAL);
 
     if (sizeof(metadata) != 16) {
         ALOGE("ERROR: metadata block is the wrong size!");
@@ -248,7 +259,7 @@ write_update_file(BackupDataWriter* dataStream, int fd, int mode, const String8&
     bytesLeft -= sizeof(metadata); // bytesLeft should == fileSize now
 
     // now store the file content
-    while ((amt = read(fd, buf, bufsize)) != 0 && bytesLeft > 0) {
+    while ((amt = read(fd, buf, bufsize)) > 0 && bytesLeft > 0) {
         bytesLeft -= amt;
         if (bytesLeft < 0) {
             amt += bytesLeft; // Plus a negative is minus.  Don't write more than we promised.
@@ -310,21 +321,26 @@ compute_crc32(const char* file, FileRec* out) {
         return -1;
     }
 
-    const int bufsize = 4*1024;
+    const int bufsize = kCrcBufferSize;
     int amt;
 
     char* buf = (char*)malloc(bufsize);
     int crc = crc32(0L, Z_NULL, 0);
 
     lseek(fd, 0, SEEK_SET);
+    posix_fadvise(fd, 0, 0, POSIX_FADV_SEQUENTIAL);
 
-    while ((amt = read(fd, buf, bufsize)) != 0) {
+    while ((amt = TEMP_FAILURE_RETRY(read(fd, buf, bufsize))) > 0) {
         crc = crc32(crc, (Bytef*)buf, amt);
     }
 
     close(fd);
     free(buf);
 
+    if (amt < 0) {
+        return -1;
+    }
+
     out->s.crc32 = crc;
     return NO_ERROR;
 }
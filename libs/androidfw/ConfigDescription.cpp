@@ -27,6 +27,84 @@ namespace android {
 
 static const char* kWildcardName = "any";
 
+// Qualifiers with a fixed vocabulary are matched against these tables, in
+// order. The wildcard entry comes first so "any" resolves without scanning.
+struct QualifierValue {
+  const char* name;
+  uint8_t value;
+};
+
+static constexpr QualifierValue kOrientationValues[] = {
+    {"any", ResTable_config::ORIENTATION_ANY},
+    {"port", ResTable_config::ORIENTATION_PORT},
+    {"land", ResTable_config::ORIENTATION_LAND},
+    {"square", ResTable_config::ORIENTATION_SQUARE},
+};
+
+static constexpr QualifierValue kUiModeTypeValues[] = {
+    {"any", ResTable_config::UI_MODE_TYPE_ANY},
+    {"desk", ResTable_config::UI_MODE_TYPE_DESK},
+    {"car", ResTable_config::UI_MODE_TYPE_CAR},
+    {"television", ResTable_config::UI_MODE_TYPE_TELEVISION},
+    {"appliance", ResTable_config::UI_MODE_TYPE_APPLIANCE},
+    {"watch", ResTable_config::UI_MODE_TYPE_WATCH},
+    {"vrheadset", ResTable_config::UI_MODE_TYPE_VR_HEADSET},
+};
+
+static constexpr QualifierValue kUiModeNightValues[] = {
+    {"any", ResTable_config::UI_MODE_NIGHT_ANY},
+    {"night", ResTable_config::UI_MODE_NIGHT_YES},
+    {"notnight", ResTable_config::UI_MODE_NIGHT_NO},
+};
+
+static constexpr QualifierValue kTouchscreenValues[] = {
+    {"any", ResTable_config::TOUCHSCREEN_ANY},
+    {"notouch", ResTable_config::TOUCHSCREEN_NOTOUCH},
+    {"stylus", ResTable_config::TOUCHSCREEN_STYLUS},
+    {"finger", ResTable_config::TOUCHSCREEN_FINGER},
+};
+
+static constexpr QualifierValue kKeysHiddenValues[] = {
+    {"any", ResTable_config::KEYSHIDDEN_ANY},
+    {"keysexposed", ResTable_config::KEYSHIDDEN_NO},
+    {"keyshidden", ResTable_config::KEYSHIDDEN_YES},
+    {"keyssoft", ResTable_config::KEYSHIDDEN_SOFT},
+};
+
+static constexpr QualifierValue kKeyboardValues[] = {
+    {"any", ResTable_config::KEYBOARD_ANY},
+    {"nokeys", ResTable_config::KEYBOARD_NOKEYS},
+    {"qwerty", ResTable_config::KEYBOARD_QWERTY},
+    {"12key", ResTable_config::KEYBOARD_12KEY},
+};
+
+static constexpr QualifierValue kNavHiddenValues[] = {
+    {"any", ResTable_config::NAVHIDDEN_ANY},
+    {"navexposed", ResTable_config::NAVHIDDEN_NO},
+    {"navhidden", ResTable_config::NAVHIDDEN_YES},
+};
+
+static constexpr QualifierValue kNavigationValues[] = {
+    {"any", ResTable_config::NAVIGATION_ANY},
+    {"nonav", ResTable_config::NAVIGATION_NONAV},
+    {"dpad", ResTable_config::NAVIGATION_DPAD},
+    {"trackball", ResTable_config::NAVIGATION_TRACKBALL},
+    {"wheel", ResTable_config::NAVIGATION_WHEEL},
+};
+
+template <size_t N>
+static bool lookupQualifier(const char* name, const QualifierValue (&values)[N],
+                            uint8_t* out_value) {
+  for (const QualifierValue& entry : values) {
+    // Most candidates differ in the first character, which saves the call.
+    if (entry.name[0] == name[0] && strcmp(entry.name, name) == 0) {
+      *out_value = entry.value;
+      return true;
+    }
+  }
+  return false;
+}
+
 const ConfigDescription& ConfigDescription::DefaultConfig() {
   static ConfigDescription config = {};
   return config;
@@ -247,83 +325,30 @@ static bool parseHdr(const char* name, ResTable_config* out) {
 }
 
 static bool parseOrientation(const char* name, ResTable_config* out) {
-  if (strcmp(name, kWildcardName) == 0) {
-    if (out) out->orientation = out->ORIENTATION_ANY;
-    return true;
-  } else if (strcmp(name, "port") == 0) {
-    if (out) out->orientation = out->ORIENTATION_PORT;
-    return true;
-  } else if (strcmp(name, "land") == 0) {
-    if (out) out->orientation = out->ORIENTATION_LAND;
-    return true;
-  } else if (strcmp(name, "square") == 0) {
-    if (out) out->orientation = out->ORIENTATION_SQUARE;
-    return true;
+  uint8_t value;
+  if (!lookupQualifier(name, kOrientationValues, &value)) {
+    return false;
   }
-
-  return false;
+  if (out) out->orientation = value;
+  return true;
 }
 
 static bool parseUiModeType(const char* name, ResTable_config* out) {
-  if (strcmp(name, kWildcardName) == 0) {
-    if (out)
-      out->uiMode = (out->uiMode & ~ResTable_config::MASK_UI_MODE_TYPE) |
-                    ResTable_config::UI_MODE_TYPE_ANY;
-    return true;
-  } else if (strcmp(name, "desk") == 0) {
-    if (out)
-      out->uiMode = (out->uiMode & ~ResTable_config::MASK_UI_MODE_TYPE) |
-                    ResTable_config::UI_MODE_TYPE_DESK;
-    return true;
-  } else if (strcmp(name, "car") == 0) {
-    if (out)
-      out->uiMode = (out->uiMode & ~ResTable_config::MASK_UI_MODE_TYPE) |
-                    ResTable_config::UI_MODE_TYPE_CAR;
-    return true;
-  } else if (strcmp(name, "television") == 0) {
-    if (out)
-      out->uiMode = (out->uiMode & ~ResTable_config::MASK_UI_MODE_TYPE) |
-                    ResTable_config::UI_MODE_TYPE_TELEVISION;
-    return true;
-  } else if (strcmp(name, "appliance") == 0) {
-    if (out)
-      out->uiMode = (out->uiMode & ~ResTable_config::MASK_UI_MODE_TYPE) |
-                    ResTable_config::UI_MODE_TYPE_APPLIANCE;
-    return true;
-  } else if (strcmp(name, "watch") == 0) {
-    if (out)
-      out->uiMode = (out->uiMode & ~ResTable_config::MASK_UI_MODE_TYPE) |
-                    ResTable_config::UI_MODE_TYPE_WATCH;
-    return true;
-  } else if (strcmp(name, "vrheadset") == 0) {
-    if (out)
-      out->uiMode = (out->uiMode & ~ResTable_config::MASK_UI_MODE_TYPE) |
-                    ResTable_config::UI_MODE_TYPE_VR_HEADSET;
-    return true;
+  uint8_t value;
+  if (!lookupQualifier(name, kUiModeTypeValues, &value)) {
+    return false;
   }
-
-  return false;
+  if (out) out->uiMode = (out->uiMode & ~ResTable_config::MASK_UI_MODE_TYPE) | value;
+  return true;
 }
 
 static bool parseUiModeNight(const char* name, ResTable_config* out) {
-  if (strcmp(name, kWildcardName) == 0) {
-    if (out)
-      out->uiMode = (out->uiMode & ~ResTable_config::MASK_UI_MODE_NIGHT) |
-                    ResTable_config::UI_MODE_NIGHT_ANY;
-    return true;
-  } else if (strcmp(name, "night") == 0) {
-    if (out)
-      out->uiMode = (out->uiMode & ~ResTable_config::MASK_UI_MODE_NIGHT) |
-                    ResTable_config::UI_MODE_NIGHT_YES;
-    return true;
-  } else if (strcmp(name, "notnight") == 0) {
-    if (out)
-      out->uiMode = (out->uiMode & ~ResTable_config::MASK_UI_MODE_NIGHT) |
-                    ResTable_config::UI_MODE_NIGHT_NO;
-    return true;
+  uint8_t value;
+  if (!lookupQualifier(name, kUiModeNightValues, &value)) {
+    return false;
   }
-
-  return false;
+  if (out) out->uiMode = (out->uiMode & ~ResTable_config::MASK_UI_MODE_NIGHT) | value;
+  return true;
 }
 
 static bool parseDensity(const char* name, ResTable_config* out) {
@@ -405,107 +430,48 @@ static bool parseDensity(const char* name, ResTable_config* out) {
 }
 
 static bool parseTouchscreen(const char* name, ResTable_config* out) {
-  if (strcmp(name, kWildcardName) == 0) {
-    if (out) out->touchscreen = out->TOUCHSCREEN_ANY;
-    return true;
-  } else if (strcmp(name, "notouch") == 0) {
-    if (out) out->touchscreen = out->TOUCHSCREEN_NOTOUCH;
-    return true;
-  } else if (strcmp(name, "stylus") == 0) {
-    if (out) out->touchscreen = out->TOUCHSCREEN_STYLUS;
-    return true;
-  } else if (strcmp(name, "finger") == 0) {
-    if (out) out->touchscreen = out->TOUCHSCREEN_FINGER;
-    return true;
+  uint8_t value;
+  if (!lookupQualifier(name, kTouchscreenValues, &value)) {
+    return false;
   }
-
-  return false;
+  if (out) out->touchscreen = value;
+  return true;
 }
 
 static bool parseKeysHidden(const char* name, ResTable_config* out) {
-  uint8_t mask = 0;
-  uint8_t value = 0;
-  if (strcmp(name, kWildcardName) == 0) {
-    mask = ResTable_config::MASK_KEYSHIDDEN;
-    value = ResTable_config::KEYSHIDDEN_ANY;
-  } else if (strcmp(name, "keysexposed") == 0) {
-    mask = ResTable_config::MASK_KEYSHIDDEN;
-    value = ResTable_config::KEYSHIDDEN_NO;
-  } else if (strcmp(name, "keyshidden") == 0) {
-    mask = ResTable_config::MASK_KEYSHIDDEN;
-    value = ResTable_config::KEYSHIDDEN_YES;
-  } else if (strcmp(name, "keyssoft") == 0) {
-    mask = ResTable_config::MASK_KEYSHIDDEN;
-    value = ResTable_config::KEYSHIDDEN_SOFT;
-  }
-
-  if (mask != 0) {
-    if (out) out->inputFlags = (out->inputFlags & ~mask) | value;
-    return true;
+  uint8_t value;
+  if (!lookupQualifier(name, kKeysHiddenValues, &value)) {
+    return false;
   }
-
-  return false;
+  if (out) out->inputFlags = (out->inputFlags & ~ResTable_config::MASK_KEYSHIDDEN) | value;
+  return true;
 }
 
 static bool parseKeyboard(const char* name, ResTable_config* out) {
-  if (strcmp(name, kWildcardName) == 0) {
-    if (out) out->keyboard = out->KEYBOARD_ANY;
-    return true;
-  } else if (strcmp(name, "nokeys") == 0) {
-    if (out) out->keyboard = out->KEYBOARD_NOKEYS;
-    return true;
-  } else if (strcmp(name, "qwerty") == 0) {
-    if (out) out->keyboard = out->KEYBOARD_QWERTY;
-    return true;
-  } else if (strcmp(name, "12key") == 0) {
-    if (out) out->keyboard = out->KEYBOARD_12KEY;
-    return true;
+  uint8_t value;
+  if (!lookupQualifier(name, kKeyboardValues, &value)) {
+    return false;
   }
-
-  return false;
+  if (out) out->keyboard = value;
+  return true;
 }
 
 static bool parseNavHidden(const char* name, ResTable_config* out) {
-  uint8_t mask = 0;
-  uint8_t value = 0;
-  if (strcmp(name, kWildcardName) == 0) {
-    mask = ResTable_config::MASK_NAVHIDDEN;
-    value = ResTable_config::NAVHIDDEN_ANY;
-  } else if (strcmp(name, "navexposed") == 0) {
-    mask = ResTable_config::MASK_NAVHIDDEN;
-    value = ResTable_config::NAVHIDDEN_NO;
-  } else if (strcmp(name, "navhidden") == 0) {
-    mask = ResTable_config::MASK_NAVHIDDEN;
-    value = ResTable_config::NAVHIDDEN_YES;
-  }
-
-  if (mask != 0) {
-    if (out) out->inputFlags = (out->inputFlags & ~mask) | value;
-    return true;
+  uint8_t value;
+  if (!lookupQualifier(name, kNavHiddenValues, &value)) {
+    return false;
   }
-
-  return false;
+  if (out) out->inputFlags = (out->inputFlags & ~ResTable_config::MASK_NAVHIDDEN) | value;
+  return true;
 }
 
 static bool parseNavigation(const char* name, ResTable_config* out) {
-  if (strcmp(name, kWildcardName) == 0) {
-    if (out) out->navigation = out->NAVIGATION_ANY;
-    return true;
-  } else if (strcmp(name, "nonav") == 0) {
-    if (out) out->navigation = out->NAVIGATION_NONAV;
-    return true;
-  } else if (strcmp(name, "dpad") == 0) {
-    if (out) out->navigation = out->NAVIGATION_DPAD;
-    return true;
-  } else if (strcmp(name, "trackball") == 0) {
-    if (out) out->navigation = out->NAVIGATION_TRACKBALL;
-    return true;
-  } else if (strcmp(name, "wheel") == 0) {
-    if (out) out->navigation = out->NAVIGATION_WHEEL;
-    return true;
+  uint8_t value;
+  if (!lookupQualifier(name, kNavigationValues, &value)) {
+    return false;
   }
-
-  return false;
+  if (out) out->navigation = value;
+  return true;
 }
 
 static bool parseScreenSize(const char* name, ResTable_config* out) {
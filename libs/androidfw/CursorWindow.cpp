@@ -305,6 +305,20 @@ status_t CursorWindow::allocRow() {
     return OK;
 }
 
+status_t CursorWindow::allocRowWithHeapSize(size_t heapSize) {
+    if (mReadOnly) {
+        return INVALID_OPERATION;
+    }
+    size_t size = mNumColumns * kSlotSizeBytes + heapSize;
+    if (size > freeSpace()) {
+        maybeInflate();
+        if (size > freeSpace()) {
+            return NO_MEMORY;
+        }
+    }
+    return allocRow();
+}
+
 status_t CursorWindow::freeLastRow() {
     if (mReadOnly) {
         return INVALID_OPERATION;
@@ -324,7 +338,7 @@ status_t CursorWindow::alloc(size_t size, uint32_t* outOffset) {
     if (mReadOnly) {
         return INVALID_OPERATION;
     }
-    size_t alignedSize = (size + 3) & ~3;
+    size_t alignedSize = heapSizeOf(size);
     size_t newOffset = mAllocOffset + alignedSize;
     if (newOffset > mSlotsOffset) {
         maybeInflate();
@@ -138,11 +138,13 @@ status_t OverlayDynamicRefTable::lookupResourceIdNoRewrite(uint32_t* resId) cons
 IdmapResMap::IdmapResMap(const Idmap_data_header* data_header,
                          const Idmap_target_entry* entries,
                          const Idmap_target_entry_inline* inline_entries,
+                         const std::bitset<256>* target_types,
                          uint8_t target_assigned_package_id,
                          const OverlayDynamicRefTable* overlay_ref_table)
     : data_header_(data_header),
       entries_(entries),
       inline_entries_(inline_entries),
+      target_types_(target_types),
       target_assigned_package_id_(target_assigned_package_id),
       overlay_ref_table_(overlay_ref_table) { }
 
@@ -156,6 +158,11 @@ IdmapResMap::Result IdmapResMap::Lookup(uint32_t target_res_id) const {
   // package id when determining if the resource in the target package is overlaid.
   target_res_id &= 0x00FFFFFFU;
 
+  if (!target_types_->test((target_res_id >> 16U) & 0xFFU)) {
+    // The overlay does not overlay any resource of this type.
+    return {};
+  }
+
   // Check if the target resource is mapped to an overlay resource.
   auto first_entry = entries_;
   auto end_entry = entries_ + dtohl(data_header_->target_entry_count);
@@ -250,7 +257,14 @@ LoadedIdmap::LoadedIdmap(std::string&& idmap_path,
        idmap_path_(std::move(idmap_path)),
        overlay_apk_path_(overlay_apk_path),
        target_apk_path_(target_apk_path),
-       idmap_last_mod_time_(getFileModDate(idmap_path_.data())) {}
+       idmap_last_mod_time_(getFileModDate(idmap_path_.data())) {
+  for (size_t i = 0, n = dtohl(data_header_->target_entry_count); i < n; i++) {
+    target_types_.set((dtohl(target_entries_[i].target_id) >> 16U) & 0xFFU);
+  }
+  for (size_t i = 0, n = dtohl(data_header_->target_inline_entry_count); i < n; i++) {
+    target_types_.set((dtohl(target_inline_entries_[i].target_id) >> 16U) & 0xFFU);
+  }
+}
 
 std::unique_ptr<LoadedIdmap> LoadedIdmap::Load(const StringPiece& idmap_path,
                                                const StringPiece& idmap_data) {
@@ -19,6 +19,7 @@
 #include "androidfw/LoadedArsc.h"
 
 #include <algorithm>
+#include <array>
 #include <cstddef>
 #include <limits>
 
@@ -354,26 +355,15 @@ void LoadedPackage::CollectLocales(bool canonicalize, std::set<std::string>* out
   }
 }
 
-base::expected<uint32_t, NullOrIOError> LoadedPackage::FindEntryByName(
-    const std::u16string& type_name, const std::u16string& entry_name) const {
-  const base::expected<size_t, NullOrIOError> type_idx = type_string_pool_.indexOfString(
-      type_name.data(), type_name.size());
-  if (!type_idx.has_value()) {
-    return base::unexpected(type_idx.error());
-  }
-
-  const base::expected<size_t, NullOrIOError> key_idx = key_string_pool_.indexOfString(
-      entry_name.data(), entry_name.size());
-  if (!key_idx.has_value()) {
-    return base::unexpected(key_idx.error());
-  }
-
-  const TypeSpec* type_spec = GetTypeSpecByTypeIndex(*type_idx);
-  if (type_spec == nullptr) {
-    return base::unexpected(std::nullopt);
-  }
-
-  for (const auto& type_entry : type_spec->type_entries) {
+// Maps the key string index of every entry defined by `type_spec` to its entry index. When a key
+// is defined more than once, the first entry found in the order of the type's configurations wins.
+// Entries whose pages are not available yet (incremental installs) are left out of the index and
+// `pages_missing` is set, so that the rest of the type can still be looked up.
+static std::unordered_map<uint32_t, uint16_t> BuildEntryNameIndex(const TypeSpec& type_spec,
+                                                                  bool* pages_missing) {
+  std::unordered_map<uint32_t, uint16_t> index;
+  *pages_missing = false;
+  for (const auto& type_entry : type_spec.type_entries) {
     const incfs::verified_map_ptr<ResTable_type>& type = type_entry.type;
 
     size_t entry_count = dtohl(type->entryCount);
@@ -381,7 +371,8 @@ base::expected<uint32_t, NullOrIOError> LoadedPackage::FindEntryByName(
       auto entry_offset_ptr = type.offset(dtohs(type->header.headerSize)).convert<uint32_t>() +
           entry_idx;
       if (!entry_offset_ptr) {
-        return base::unexpected(IOError::PAGES_MISSING);
+        *pages_missing = true;
+        continue;
       }
 
       uint32_t offset;
@@ -397,18 +388,69 @@ base::expected<uint32_t, NullOrIOError> LoadedPackage::FindEntryByName(
       if (offset != ResTable_type::NO_ENTRY) {
         auto entry = type.offset(dtohl(type->entriesStart) + offset).convert<ResTable_entry>();
         if (!entry) {
-          return base::unexpected(IOError::PAGES_MISSING);
-        }
-
-        if (dtohl(entry->key.index) == static_cast<uint32_t>(*key_idx)) {
-          // The package ID will be overridden by the caller (due to runtime assignment of package
-          // IDs for shared libraries).
-          return make_resid(0x00, *type_idx + type_id_offset_ + 1, res_idx);
+          *pages_missing = true;
+          continue;
         }
+        index.emplace(dtohl(entry->key.index), res_idx);
       }
     }
   }
-  return base::unexpected(std::nullopt);
+  return index;
+}
+
+base::expected<uint32_t, NullOrIOError> LoadedPackage::FindEntryByName(
+    const std::u16string& type_name, const std::u16string& entry_name) const {
+  const base::expected<size_t, NullOrIOError> type_idx = type_string_pool_.indexOfString(
+      type_name.data(), type_name.size());
+  if (!type_idx.has_value()) {
+    return base::unexpected(type_idx.error());
+  }
+
+  const base::expected<size_t, NullOrIOError> key_idx = key_string_pool_.indexOfString(
+      entry_name.data(), entry_name.size());
+  if (!key_idx.has_value()) {
+    return base::unexpected(key_idx.error());
+  }
+
+  const TypeSpec* type_spec = GetTypeSpecByTypeIndex(*type_idx);
+  if (type_spec == nullptr) {
+    return base::unexpected(std::nullopt);
+  }
+
+  // The index of a type is built the first time one of its entries is looked up by name.
+  std::lock_guard<std::mutex> lock(entry_name_index_lock_);
+  auto [index, inserted] = entry_name_index_.try_emplace(*type_idx);
+  EntryNameIndex& type_index = index->second;
+  if (inserted) {
+    type_index.entries = BuildEntryNameIndex(*type_spec, &type_index.pages_missing);
+  }
+
+  auto entry = type_index.entries.find(static_cast<uint32_t>(*key_idx));
+  if (entry == type_index.entries.end() && type_index.pages_missing) {
+    // The entry may be in pages that were missing when the index was built. Rebuild it in case they
+    // have arrived since.
+    type_index.entries = BuildEntryNameIndex(*type_spec, &type_index.pages_missing);
+    entry = type_index.entries.find(static_cast<uint32_t>(*key_idx));
+  }
+  if (entry == type_index.entries.end()) {
+    if (type_index.pages_missing) {
+      return base::unexpected(IOError::PAGES_MISSING);
+    }
+    return base::unexpected(std::nullopt);
+  }
+
+  // The package ID will be overridden by the caller (due to runtime assignment of package IDs for
+  // shared libraries).
+  return make_resid(0x00, *type_idx + type_id_offset_ + 1, entry->second);
+}
+
+size_t LoadedPackage::GetEntryNameIndexSize() const {
+  std::lock_guard<std::mutex> lock(entry_name_index_lock_);
+  size_t size = 0U;
+  for (const auto& type_index : entry_name_index_) {
+    size += type_index.second.entries.size();
+  }
+  return size;
 }
 
 const LoadedPackage* LoadedArsc::GetPackageById(uint8_t package_id) const {
@@ -467,10 +509,12 @@ std::unique_ptr<const LoadedPackage> LoadedPackage::Load(const Chunk& chunk,
   util::ReadUtf16StringFromDevice(header->name, arraysize(header->name),
                                   &loaded_package->package_name_);
 
-  // A map of TypeSpec builders, each associated with an type index.
+  // TypeSpec builders, indexed by type ID.
   // We use these to accumulate the set of Types available for a TypeSpec, and later build a single,
   // contiguous block of memory that holds all the Types together with the TypeSpec.
-  std::unordered_map<int, std::unique_ptr<TypeSpecBuilder>> type_builder_map;
+  // Type IDs are a single byte, so a flat array avoids hashing for every type chunk.
+  std::array<std::unique_ptr<TypeSpecBuilder>, std::numeric_limits<uint8_t>::max() + 1>
+      type_builder_map;
 
   ChunkIterator iter(chunk.data_ptr(), chunk.data_size());
   while (iter.HasNext()) {
@@ -741,10 +785,11 @@ std::unique_ptr<const LoadedPackage> LoadedPackage::Load(const Chunk& chunk,
   }
 
   // Flatten and construct the TypeSpecs.
-  for (auto& entry : type_builder_map) {
-    TypeSpec type_spec = entry.second->Build();
-    uint8_t type_id = static_cast<uint8_t>(entry.first);
-    loaded_package->type_specs_[type_id] = std::move(type_spec);
+  for (size_t type_id = 0; type_id < type_builder_map.size(); type_id++) {
+    if (type_builder_map[type_id] != nullptr) {
+      loaded_package->type_specs_[static_cast<uint8_t>(type_id)] =
+          type_builder_map[type_id]->Build();
+    }
   }
 
   return std::move(loaded_package);
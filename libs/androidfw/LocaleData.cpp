@@ -132,6 +132,18 @@ inline bool isSpecialSpanish(uint32_t language_and_region) {
     return (language_and_region == US_SPANISH || language_and_region == MEXICAN_SPANISH);
 }
 
+struct RequestAncestors {
+    uint32_t request = PACKED_ROOT;
+    char script[SCRIPT_LENGTH] = {};
+    uint32_t ancestors[MAX_PARENT_DEPTH+1];
+    size_t count = 0;
+
+    inline bool matches(uint32_t packed_locale, const char* other_script) const {
+        return count != 0 && request == packed_locale &&
+                memcmp(script, other_script, SCRIPT_LENGTH) == 0;
+    }
+};
+
 int localeDataCompareRegions(
         const char* left_region, const char* right_region,
         const char* requested_language, const char* requested_script,
@@ -156,19 +168,29 @@ int localeDataCompareRegions(
         right = LATIN_AMERICAN_SPANISH;
     }
 
-    uint32_t request_ancestors[MAX_PARENT_DEPTH+1];
-    ssize_t left_right_index;
-    // Find the parents of the request, but stop as soon as we saw left or right
-    const std::array<uint32_t, 2> left_and_right = {{left, right}};
-    const size_t ancestor_count = findAncestors(
-            request_ancestors, &left_right_index,
-            request, requested_script,
-            left_and_right.data(), left_and_right.size());
-    if (left_right_index == 0) { // We saw left earlier
-        return 1;
+    // Resource matching compares many candidate regions against the same
+    // requested locale, so the request's full ancestor chain is kept for the
+    // last request seen on this thread instead of being rebuilt every time.
+    static thread_local RequestAncestors cached_request;
+    if (!cached_request.matches(request, requested_script)) {
+        ssize_t unused_index;
+        cached_request.request = request;
+        memcpy(cached_request.script, requested_script, SCRIPT_LENGTH);
+        cached_request.count = findAncestors(
+                cached_request.ancestors, &unused_index,
+                request, requested_script, nullptr, 0);
     }
-    if (left_right_index == 1) { // We saw right earlier
-        return -1;
+    const uint32_t* request_ancestors = cached_request.ancestors;
+    const size_t ancestor_count = cached_request.count;
+
+    // Walk the parents of the request, but stop as soon as we see left or right
+    for (size_t i = 0; i < ancestor_count; i++) {
+        if (request_ancestors[i] == left) { // We saw left earlier
+            return 1;
+        }
+        if (request_ancestors[i] == right) { // We saw right earlier
+            return -1;
+        }
     }
 
     // If we are here, neither left nor right are an ancestor of the
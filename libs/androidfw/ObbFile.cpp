@@ -21,8 +21,11 @@
 #include <string.h>
 #include <unistd.h>
 
+#include <vector>
+
 #define LOG_TAG "ObbFile"
 
+#include <android-base/file.h>
 #include <androidfw/ObbFile.h>
 #include <utils/Compat.h>
 #include <utils/Log.h>
@@ -43,6 +46,8 @@
 
 #define kMaxBufSize    32768 /* Maximum file read buffer */
 
+#define kTailReadSize  1024 /* Bytes read from the end of the file up front */
+
 #define kSignature     0x01059983U /* ObbFile signature */
 
 #define kSigVersion    1 /* We only know about signature version 1 */
@@ -127,18 +132,20 @@ bool ObbFile::parseObbFile(int fd)
         return false;
     }
 
-    ssize_t actual;
+    // Read the tail of the file in one go; it normally holds both the footer
+    // tag and the whole footer, saving a seek and a read per parse.
+    char tailBuf[kTailReadSize];
+    const size_t tailSize = fileLength < (off64_t) kTailReadSize
+            ? (size_t) fileLength : kTailReadSize;
+    if (!base::ReadFullyAtOffset(fd, tailBuf, tailSize, fileLength - tailSize)) {
+        ALOGW("couldn't read footer signature: %s\n", strerror(errno));
+        return false;
+    }
+
     size_t footerSize;
 
     {
-        lseek64(fd, fileLength - kFooterTagSize, SEEK_SET);
-
-        char footer[kFooterTagSize];
-        actual = TEMP_FAILURE_RETRY(read(fd, footer, kFooterTagSize));
-        if (actual != kFooterTagSize) {
-            ALOGW("couldn't read footer signature: %s\n", strerror(errno));
-            return false;
-        }
+        const char* footer = tailBuf + tailSize - kFooterTagSize;
 
         unsigned int fileSig = get4LE((unsigned char*)footer + sizeof(int32_t));
         if (fileSig != kSignature) {
@@ -163,10 +170,6 @@ bool ObbFile::parseObbFile(int fd)
     }
 
     off64_t fileOffset = fileLength - footerSize - kFooterTagSize;
-    if (lseek64(fd, fileOffset, SEEK_SET) != fileOffset) {
-        ALOGW("seek %lld failed: %s\n", (long long int)fileOffset, strerror(errno));
-        return false;
-    }
 
     mFooterStart = fileOffset;
 
@@ -176,9 +179,10 @@ bool ObbFile::parseObbFile(int fd)
         return false;
     }
 
-    actual = TEMP_FAILURE_RETRY(read(fd, scanBuf, footerSize));
-    // readAmount is guaranteed to be less than kMaxBufSize
-    if (actual != (ssize_t)footerSize) {
+    if (footerSize + kFooterTagSize <= tailSize) {
+        memcpy(scanBuf, tailBuf + tailSize - kFooterTagSize - footerSize, footerSize);
+    } else if (!base::ReadFullyAtOffset(fd, scanBuf, footerSize, fileOffset)) {
+        // readAmount is guaranteed to be less than kMaxBufSize
         ALOGI("couldn't read ObbFile footer: %s\n", strerror(errno));
         free(scanBuf);
         return false;
@@ -255,53 +259,24 @@ bool ObbFile::writeTo(int fd)
         return false;
     }
 
-    unsigned char intBuf[sizeof(uint32_t)+1];
-    memset(&intBuf, 0, sizeof(intBuf));
-
-    put4LE(intBuf, kSigVersion);
-    if (write(fd, &intBuf, sizeof(uint32_t)) != (ssize_t)sizeof(uint32_t)) {
-        ALOGW("couldn't write signature version: %s\n", strerror(errno));
-        return false;
-    }
-
-    put4LE(intBuf, mVersion);
-    if (write(fd, &intBuf, sizeof(uint32_t)) != (ssize_t)sizeof(uint32_t)) {
-        ALOGW("couldn't write package version\n");
-        return false;
-    }
-
-    put4LE(intBuf, mFlags);
-    if (write(fd, &intBuf, sizeof(uint32_t)) != (ssize_t)sizeof(uint32_t)) {
-        ALOGW("couldn't write package version\n");
-        return false;
-    }
-
-    if (write(fd, mSalt, sizeof(mSalt)) != (ssize_t)sizeof(mSalt)) {
-        ALOGW("couldn't write salt: %s\n", strerror(errno));
-        return false;
-    }
-
-    size_t packageNameLen = mPackageName.size();
-    put4LE(intBuf, packageNameLen);
-    if (write(fd, &intBuf, sizeof(uint32_t)) != (ssize_t)sizeof(uint32_t)) {
-        ALOGW("couldn't write package name length: %s\n", strerror(errno));
-        return false;
-    }
-
-    if (write(fd, mPackageName.string(), packageNameLen) != (ssize_t)packageNameLen) {
-        ALOGW("couldn't write package name: %s\n", strerror(errno));
-        return false;
-    }
-
-    put4LE(intBuf, kPackageNameOffset + packageNameLen);
-    if (write(fd, &intBuf, sizeof(uint32_t)) != (ssize_t)sizeof(uint32_t)) {
-        ALOGW("couldn't write footer size: %s\n", strerror(errno));
-        return false;
-    }
-
-    put4LE(intBuf, kSignature);
-    if (write(fd, &intBuf, sizeof(uint32_t)) != (ssize_t)sizeof(uint32_t)) {
-        ALOGW("couldn't write footer magic signature: %s\n", strerror(errno));
+    // Lay the whole footer out in memory and append it with a single write, rather
+    // than issuing a syscall per field.
+    const size_t packageNameLen = mPackageName.size();
+    const size_t footerSize = kPackageNameOffset + packageNameLen;
+    std::vector<unsigned char> footer(footerSize + kFooterTagSize);
+    unsigned char* buf = footer.data();
+
+    put4LE(buf, kSigVersion);
+    put4LE(buf + kPackageVersionOffset, mVersion);
+    put4LE(buf + kFlagsOffset, mFlags);
+    memcpy(buf + kSaltOffset, mSalt, sizeof(mSalt));
+    put4LE(buf + kPackageNameLenOffset, packageNameLen);
+    memcpy(buf + kPackageNameOffset, mPackageName.string(), packageNameLen);
+    put4LE(buf + footerSize, footerSize);
+    put4LE(buf + footerSize + sizeof(uint32_t), kSignature);
+
+    if (!base::WriteFully(fd, buf, footer.size())) {
+        ALOGW("couldn't write ObbFile footer: %s\n", strerror(errno));
         return false;
     }
 
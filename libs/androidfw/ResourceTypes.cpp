@@ -29,6 +29,7 @@
 #include <limits>
 #include <map>
 #include <memory>
+#include <new>
 #include <set>
 #include <type_traits>
 #include <vector>
@@ -88,6 +89,25 @@ inline int isspace16(char16_t c) {
     return (c < 0x0080 && isspace(c));
 }
 
+// Returns true if none of the bytes of `str` has its high bit set. Checks eight bytes at a time.
+static bool IsAscii(const char* str, size_t len) {
+    constexpr uint64_t kHighBits = 0x8080808080808080ULL;
+    size_t i = 0;
+    for (; i + sizeof(uint64_t) <= len; i += sizeof(uint64_t)) {
+        uint64_t word;
+        memcpy(&word, str + i, sizeof(word));
+        if (word & kHighBits) {
+            return false;
+        }
+    }
+    for (; i < len; i++) {
+        if (static_cast<uint8_t>(str[i]) & 0x80U) {
+            return false;
+        }
+    }
+    return true;
+}
+
 template<typename T>
 inline static T max(T a, T b) {
     return a > b ? a : b;
@@ -681,15 +701,12 @@ status_t ResStringPool::getError() const
 void ResStringPool::uninit()
 {
     mError = NO_INIT;
-    if (mHeader && mCache != NULL) {
+    std::atomic<char16_t*>* cache = mCache.exchange(nullptr);
+    if (mHeader && cache != nullptr) {
         for (size_t x = 0; x < mHeader->stringCount; x++) {
-            if (mCache[x] != NULL) {
-                free(mCache[x]);
-                mCache[x] = NULL;
-            }
+            free(cache[x].load(std::memory_order_relaxed));
         }
-        free(mCache);
-        mCache = NULL;
+        delete[] cache;
     }
     if (mOwnedData) {
         free(mOwnedData);
@@ -811,10 +828,21 @@ base::expected<StringPiece16, NullOrIOError> ResStringPool::stringAt(size_t idx)
 
                 // encLen must be less than 0x7FFF due to encoding.
                 if ((uint32_t)(u8str+*u8len-strings) < mStringPoolSize) {
+                    // Strings that were already decoded are read without taking the lock.
+                    std::atomic<char16_t*>* cache = mCache.load(std::memory_order_acquire);
+                    if (cache != nullptr) {
+                        if (char16_t* cached = cache[idx].load(std::memory_order_acquire)) {
+                            return StringPiece16(cached, *u16len);
+                        }
+                    }
+
                     AutoMutex lock(mDecodeLock);
 
-                    if (mCache != NULL && mCache[idx] != NULL) {
-                        return StringPiece16(mCache[idx], *u16len);
+                    cache = mCache.load(std::memory_order_relaxed);
+                    if (cache != nullptr) {
+                        if (char16_t* cached = cache[idx].load(std::memory_order_relaxed)) {
+                            return StringPiece16(cached, *u16len);
+                        }
                     }
 
                     // Retrieve the actual length of the utf8 string if the
@@ -827,7 +855,9 @@ base::expected<StringPiece16, NullOrIOError> ResStringPool::stringAt(size_t idx)
                     // Since AAPT truncated lengths longer than 0x7FFF, check
                     // that the bits that remain after truncation at least match
                     // the bits of the actual length
-                    ssize_t actualLen = utf8_to_utf16_length(
+                    const bool isAscii = IsAscii(decodedString->data(), decodedString->size());
+                    ssize_t actualLen = isAscii ? static_cast<ssize_t>(decodedString->size())
+                                                : utf8_to_utf16_length(
                         reinterpret_cast<const uint8_t*>(decodedString->data()),
                         decodedString->size());
 
@@ -846,10 +876,15 @@ base::expected<StringPiece16, NullOrIOError> ResStringPool::stringAt(size_t idx)
                         return base::unexpected(std::nullopt);
                     }
 
-                    utf8_to_utf16(reinterpret_cast<const uint8_t*>(decodedString->data()),
-                                  decodedString->size(), u16str, *u16len + 1);
+                    if (isAscii) {
+                        // ASCII maps one to one onto UTF-16 code units.
+                        std::copy(decodedString->begin(), decodedString->end(), u16str);
+                    } else {
+                        utf8_to_utf16(reinterpret_cast<const uint8_t*>(decodedString->data()),
+                                      decodedString->size(), u16str, *u16len + 1);
+                    }
 
-                    if (mCache == NULL) {
+                    if (cache == nullptr) {
 #ifndef __ANDROID__
                         if (kDebugStringPoolNoisy) {
                             ALOGI("CREATING STRING CACHE OF %zu bytes",
@@ -860,19 +895,21 @@ base::expected<StringPiece16, NullOrIOError> ResStringPool::stringAt(size_t idx)
                         ALOGW("CREATING STRING CACHE OF %zu bytes",
                                 static_cast<size_t>(mHeader->stringCount*sizeof(char16_t**)));
 #endif
-                        mCache = (char16_t**)calloc(mHeader->stringCount, sizeof(char16_t*));
-                        if (mCache == NULL) {
+                        cache = new (std::nothrow) std::atomic<char16_t*>[mHeader->stringCount]();
+                        if (cache == nullptr) {
                             ALOGW("No memory trying to allocate decode cache table of %d bytes\n",
                                   (int)(mHeader->stringCount*sizeof(char16_t**)));
+                            free(u16str);
                             return base::unexpected(std::nullopt);
                         }
+                        mCache.store(cache, std::memory_order_release);
                     }
 
                     if (kDebugStringPoolNoisy) {
                       ALOGI("Caching UTF8 string: %s", u8str.unsafe_ptr());
                     }
 
-                    mCache[idx] = u16str;
+                    cache[idx].store(u16str, std::memory_order_release);
                     return StringPiece16(u16str, *u16len);
                 } else {
                     ALOGW("Bad string block: string #%lld extends to %lld, past end at %lld\n",
@@ -26,6 +26,7 @@
 #include <utils/Compat.h>
 #include <ziparchive/zip_archive.h>
 
+#include <stdint.h>
 #include <stdlib.h>
 #include <string.h>
 #include <assert.h>
@@ -143,9 +144,54 @@ class BufferWriter : public zip_archive::Writer {
     return (zip_archive::Inflate(reader, compressedLen, uncompressedLen, &writer, nullptr) == 0);
 }
 
+/*
+ * When the whole compressed stream is already mapped and the output buffer is
+ * sized exactly, inflate it with a single zlib call. This avoids staging the
+ * data through zip_archive::Inflate's fixed-size read and write buffers, which
+ * costs two extra copies of every byte.
+ */
+static bool inflateMappedBuffer(const uint8_t* in, uint8_t* out,
+    size_t uncompressedLen, size_t compressedLen)
+{
+    z_stream zstream;
+    memset(&zstream, 0, sizeof(zstream));
+    zstream.next_in = const_cast<Bytef*>(in);
+    zstream.avail_in = compressedLen;
+    zstream.next_out = out;
+    zstream.avail_out = uncompressedLen;
+
+    int zerr = inflateInit2(&zstream, -MAX_WBITS);
+    if (zerr != Z_OK) {
+        ALOGE("Installed zlib is not compatible with linked version (%s)\n", ZLIB_VERSION);
+        return false;
+    }
+
+    zerr = inflate(&zstream, Z_FINISH);
+    const bool result = (zerr == Z_STREAM_END && zstream.total_out == uncompressedLen);
+    if (!result) {
+        ALOGW("Zip inflate failed, zerr=%d (nIn=%p aIn=%u nOut=%p aOut=%u)\n", zerr,
+              zstream.next_in, zstream.avail_in, zstream.next_out, zstream.avail_out);
+    }
+    inflateEnd(&zstream);
+    return result;
+}
+
 /*static*/ bool ZipUtils::inflateToBuffer(incfs::map_ptr<void> in, void* buf,
     long uncompressedLen, long compressedLen)
 {
+    if (uncompressedLen < 0 || compressedLen < 0) {
+        return false;
+    }
+
+    // zlib counts available bytes in a uInt, so larger entries take the chunked path.
+    const incfs::map_ptr<uint8_t> input = in.convert<uint8_t>();
+    if (static_cast<unsigned long>(uncompressedLen) <= UINT32_MAX &&
+        static_cast<unsigned long>(compressedLen) <= UINT32_MAX &&
+        input.verify(compressedLen)) {
+        return inflateMappedBuffer(input.unsafe_ptr(), reinterpret_cast<uint8_t*>(buf),
+                                   uncompressedLen, compressedLen);
+    }
+
     BufferReader reader(in, compressedLen);
     BufferWriter writer(buf, uncompressedLen);
     return (zip_archive::Inflate(reader, compressedLen, uncompressedLen, &writer, nullptr) == 0);
@@ -38,6 +38,13 @@ class ApkAssets {
   static std::unique_ptr<ApkAssets> Load(const std::string& path,
                                          package_property_t flags = 0U);
 
+  // Creates an ApkAssets for each of the paths on device, loading up to `max_threads` of them
+  // concurrently. The result has the same order as `paths`; an element is nullptr if the APK at
+  // that path failed to load.
+  static std::vector<std::unique_ptr<ApkAssets>> LoadAll(const std::vector<std::string>& paths,
+                                                         package_property_t flags = 0U,
+                                                         size_t max_threads = 4U);
+
   // Creates an ApkAssets from an open file descriptor.
   static std::unique_ptr<ApkAssets> LoadFromFd(base::unique_fd fd,
                                                const std::string& debug_name,
@@ -23,6 +23,7 @@
 #include <limits>
 #include <set>
 #include <unordered_map>
+#include <variant>
 
 #include "androidfw/ApkAssets.h"
 #include "androidfw/Asset.h"
@@ -72,10 +73,42 @@ struct ResolvedBag {
   Entry entries[0];
 };
 
-struct FindEntryResult;
+struct FindEntryResult {
+  // The cookie representing the ApkAssets in which the value resides.
+  ApkAssetsCookie cookie;
+
+  // The value of the resource table entry. Either an android::Res_value for non-bag types or an
+  // incfs::verified_map_ptr<ResTable_map_entry> for bag types.
+  std::variant<Res_value, incfs::verified_map_ptr<ResTable_map_entry>> entry;
+
+  // The configuration for which the resulting entry was defined. This is already swapped to host
+  // endianness.
+  ResTable_config config;
+
+  // The bitmask of configuration axis with which the resource value varies.
+  uint32_t type_flags;
+
+  // The dynamic package ID map for the package from which this resource came from.
+  const DynamicRefTable* dynamic_ref_table;
+
+  // The package name of the resource.
+  const std::string* package_name;
+
+  // The string pool reference to the type's name. This uses a different string pool than
+  // the global string pool, but this is hidden from the caller.
+  StringPoolRef type_string_ref;
+
+  // The string pool reference to the entry's name. This uses a different string pool than
+  // the global string pool, but this is hidden from the caller.
+  StringPoolRef entry_string_ref;
+};
 
 // AssetManager2 is the main entry point for accessing assets and resources.
 // AssetManager2 provides caching of resources retrieved via the underlying ApkAssets.
+//
+// NOTE: AssetManager2 is not thread-safe. The const lookup methods (FindEntry, GetResource,
+// GetBag, ResolveReference...) populate internal caches and the resource resolution log, so all
+// calls, including concurrent reads, must be serialized by the caller (see Guarded<AssetManager2>).
 class AssetManager2 {
   friend Theme;
 
@@ -336,6 +369,11 @@ class AssetManager2 {
   // AssetManager configuration.
   struct FilteredConfigGroup {
       std::vector<const TypeSpec::TypeEntry*> type_entries;
+
+      // Copies of the configurations of `type_entries`, in the same order. Keeping them packed
+      // together means that selecting the best match reads one contiguous array instead of
+      // chasing a pointer to every TypeEntry, which are scattered across the LoadedPackage.
+      std::vector<ResTable_config> configs;
   };
 
   // Represents an single package.
@@ -400,6 +438,9 @@ class AssetManager2 {
       const ResTable_config& desired_config, bool stop_at_first_match,
       bool ignore_configuration) const;
 
+  // Adds a FindEntry() result to cached_entries_, evicting an entry if the cache is full.
+  void CacheEntry(uint64_t cache_key, const FindEntryResult& result) const;
+
   // Assigns package IDs to all shared library ApkAssets.
   // Should be called whenever the ApkAssets are changed.
   void BuildDynamicRefTable();
@@ -449,6 +490,23 @@ class AssetManager2 {
   // Cached set of resolved resource values.
   mutable std::unordered_map<uint32_t, SelectedValue> cached_resolved_values_;
 
+  // Cached results of FindEntry() for the current configuration, keyed by the resource ID, the
+  // density override and the search flags. The cache is bounded by kMaxCachedEntries, evicts one
+  // entry at a time with the clock algorithm, and is discarded whenever the filtered configuration
+  // lists are rebuilt.
+  struct CachedEntry {
+    uint64_t key;
+    FindEntryResult result;
+
+    // Whether the entry was hit since the clock hand last passed it.
+    bool referenced;
+  };
+  mutable std::vector<CachedEntry> cached_entries_;
+  mutable std::unordered_map<uint64_t, size_t> cached_entry_slots_;
+  mutable size_t cached_entries_hand_ = 0U;
+  mutable uint64_t cached_entries_hits_ = 0U;
+  mutable uint64_t cached_entries_misses_ = 0U;
+
   // Whether or not to save resource resolution steps
   bool resource_resolution_logging_enabled_ = false;
 
@@ -97,7 +97,13 @@ struct ZipAssetsProvider : public AssetsProvider {
   WARN_UNUSED bool IsUpToDate() const override;
   WARN_UNUSED std::optional<uint32_t> GetCrc(std::string_view path) const;
 
-  ~ZipAssetsProvider() override = default;
+  // Enables or disables the process-wide cache of inflated compressed entries opened with
+  // Asset::ACCESS_BUFFER. It is disabled by default, and must stay disabled in processes that
+  // fork without closing unknown file descriptors, such as the zygote, because each entry holds
+  // an ashmem file descriptor. Disabling it drops the cached entries.
+  static void SetInflatedAssetCacheEnabled(bool enabled);
+
+  ~ZipAssetsProvider() override;
  protected:
   std::unique_ptr<Asset> OpenInternal(const std::string& path, Asset::AccessMode mode,
                                       bool* file_exists) const override;
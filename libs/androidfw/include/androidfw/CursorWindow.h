@@ -98,6 +98,13 @@ public:
      * The row is initialized will null entries for each field.
      */
     status_t allocRow();
+    /**
+     * Allocate a row slot like allocRow(), after first making sure the window
+     * also has room for heapSize bytes of string/blob data for that row,
+     * inflating it if needed. Fails without allocating anything if the row
+     * would not fit, so callers never leave a partially copied row behind.
+     */
+    status_t allocRowWithHeapSize(size_t heapSize);
     status_t freeLastRow();
 
     status_t putBlob(uint32_t row, uint32_t column, const void* value, size_t size);
@@ -112,6 +119,14 @@ public:
      */
     FieldSlot* getFieldSlot(uint32_t row, uint32_t column);
 
+    /**
+     * Returns the number of heap bytes a string or blob of the given size
+     * occupies in the window.
+     */
+    static inline size_t heapSizeOf(size_t size) {
+        return (size + 3) & ~3;
+    }
+
     inline int32_t getFieldSlotType(FieldSlot* fieldSlot) {
         return fieldSlot->type;
     }
@@ -17,6 +17,7 @@
 #ifndef IDMAP_H_
 #define IDMAP_H_
 
+#include <bitset>
 #include <memory>
 #include <string>
 #include <unordered_map>
@@ -129,12 +130,14 @@ class IdmapResMap {
   explicit IdmapResMap(const Idmap_data_header* data_header,
                        const Idmap_target_entry* entries,
                        const Idmap_target_entry_inline* inline_entries,
+                       const std::bitset<256>* target_types,
                        uint8_t target_assigned_package_id,
                        const OverlayDynamicRefTable* overlay_ref_table);
 
   const Idmap_data_header* data_header_;
   const Idmap_target_entry* entries_;
   const Idmap_target_entry_inline* inline_entries_;
+  const std::bitset<256>* target_types_;
   const uint8_t target_assigned_package_id_;
   const OverlayDynamicRefTable* overlay_ref_table_;
 
@@ -170,7 +173,7 @@ class LoadedIdmap {
   // Returns a mapping from target resource ids to overlay values.
   const IdmapResMap GetTargetResourcesMap(uint8_t target_assigned_package_id,
                                           const OverlayDynamicRefTable* overlay_ref_table) const {
-    return IdmapResMap(data_header_, target_entries_, target_inline_entries_,
+    return IdmapResMap(data_header_, target_entries_, target_inline_entries_, &target_types_,
                        target_assigned_package_id, overlay_ref_table);
   }
 
@@ -199,6 +202,10 @@ class LoadedIdmap {
   std::string_view target_apk_path_;
   time_t idmap_last_mod_time_;
 
+  // The set of target type ids that have at least one overlaid entry, so that lookups of
+  // resources in types the overlay does not touch can skip searching the entries.
+  std::bitset<256> target_types_;
+
  private:
   DISALLOW_COPY_AND_ASSIGN(LoadedIdmap);
 
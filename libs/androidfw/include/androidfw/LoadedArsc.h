@@ -19,6 +19,7 @@
 
 #include <map>
 #include <memory>
+#include <mutex>
 #include <set>
 #include <vector>
 #include <unordered_map>
@@ -166,6 +167,10 @@ class LoadedPackage {
   base::expected<uint32_t, NullOrIOError> FindEntryByName(const std::u16string& type_name,
                                                           const std::u16string& entry_name) const;
 
+  // Returns the number of entries held by the name index that FindEntryByName builds lazily for
+  // each type it is queried for.
+  size_t GetEntryNameIndexSize() const;
+
   static base::expected<incfs::map_ptr<ResTable_entry>, NullOrIOError> GetEntry(
       incfs::verified_map_ptr<ResTable_type> type_chunk, uint16_t entry_index);
 
@@ -298,6 +303,17 @@ class LoadedPackage {
   std::vector<const std::pair<OverlayableInfo, std::unordered_set<uint32_t>>> overlayable_infos_;
   std::map<uint32_t, uint32_t> alias_id_map_;
 
+  // Lazily built map of type index to (key string index -> entry index), used to resolve resource
+  // names without scanning every entry of every configuration of the type.
+  struct EntryNameIndex {
+    std::unordered_map<uint32_t, uint16_t> entries;
+
+    // Whether some entries of the type could not be read when the index was built.
+    bool pages_missing = false;
+  };
+  mutable std::mutex entry_name_index_lock_;
+  mutable std::unordered_map<size_t, EntryNameIndex> entry_name_index_;
+
   // A map of overlayable name to actor
   std::unordered_map<std::string, std::string> overlayable_map_;
 };
@@ -39,6 +39,7 @@
 #include <android/configuration.h>
 
 #include <array>
+#include <atomic>
 #include <map>
 #include <memory>
 
@@ -557,7 +558,9 @@ private:
     incfs::map_ptr<uint32_t>                      mEntries;
     incfs::map_ptr<uint32_t>                      mEntryStyles;
     incfs::map_ptr<void>                          mStrings;
-    char16_t mutable**                            mCache;
+    // UTF-16 copies of the strings of a UTF-8 pool, decoded on demand. Slots are published with
+    // release stores so that readers can use decoded strings without taking mDecodeLock.
+    mutable std::atomic<std::atomic<char16_t*>*>  mCache;
     uint32_t                                      mStringPoolSize;    // number of uint16_t
     incfs::map_ptr<uint32_t>                      mStyles;
     uint32_t                                      mStylePoolSize;    // number of uint32_t
@@ -59,6 +59,21 @@ TEST(ApkAssetsTest, LoadApkFromFd) {
   ASSERT_THAT(loaded_apk->GetAssetsProvider()->Open("res/layout/main.xml"), NotNull());
 }
 
+TEST(ApkAssetsTest, LoadAllApks) {
+  const std::vector<std::string> paths = {GetTestDataPath() + "/basic/basic.apk",
+                                          GetTestDataPath() + "/does_not_exist.apk",
+                                          GetTestDataPath() + "/basic/basic_de_fr.apk"};
+  std::vector<std::unique_ptr<ApkAssets>> loaded_apks = ApkAssets::LoadAll(paths);
+  ASSERT_THAT(loaded_apks, SizeIs(paths.size()));
+  ASSERT_THAT(loaded_apks[0], NotNull());
+  EXPECT_THAT(loaded_apks[1], ::testing::IsNull());
+  ASSERT_THAT(loaded_apks[2], NotNull());
+
+  EXPECT_EQ(paths[0], std::string(loaded_apks[0]->GetPath().value_or("")));
+  EXPECT_EQ(paths[2], std::string(loaded_apks[2]->GetPath().value_or("")));
+  ASSERT_THAT(loaded_apks[0]->GetLoadedArsc()->GetPackageById(0x7fu), NotNull());
+}
+
 TEST(ApkAssetsTest, LoadApkAsSharedLibrary) {
   std::unique_ptr<const ApkAssets> loaded_apk =
       ApkAssets::Load(GetTestDataPath() + "/appaslib/appaslib.apk");
@@ -0,0 +1,253 @@
+/*
+ * Copyright (C) 2021 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include <algorithm>
+#include <memory>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "android-base/stringprintf.h"
+#include "android-base/strings.h"
+#include "androidfw/ApkAssets.h"
+#include "androidfw/AssetManager2.h"
+#include "androidfw/ResourceTypes.h"
+
+// Benchmarks that run against a configurable set of real APKs rather than the small test APKs,
+// e.g. framework-res plus a device's overlays, or an app with all of its splits:
+//
+//   export ANDROIDFW_BENCH_CORPUS=/system/framework/framework-res.apk:/vendor/overlay/a.apk:...
+//   libandroidfw_benchmarks --benchmark_filter=BM_Corpus --benchmark_repetitions=20
+//
+// When repetitions are requested, the slowest repetition is reported as "max" alongside the
+// default mean/median/stddev. The GetBag, ApplyStyle and FindEntry benchmarks look resources up by
+// name in the android package, so the corpus must include framework-res for them to run.
+
+namespace android {
+
+constexpr const static char* kCorpusEnv = "ANDROIDFW_BENCH_CORPUS";
+constexpr const static char* kDefaultCorpus = "/system/framework/framework-res.apk";
+constexpr const static char* kStyleName = "android:style/Theme.Material.Light";
+constexpr const static char* kStringName = "android:string/ok";
+
+static std::vector<std::string> GetCorpusPaths() {
+  const char* corpus = getenv(kCorpusEnv);
+  std::vector<std::string> paths = base::Split(corpus != nullptr ? corpus : kDefaultCorpus, ":");
+  paths.erase(std::remove(paths.begin(), paths.end(), ""), paths.end());
+  return paths;
+}
+
+struct Corpus {
+  std::vector<std::unique_ptr<const ApkAssets>> apk_assets;
+  std::vector<const ApkAssets*> apk_assets_ptrs;
+};
+
+static bool LoadCorpus(benchmark::State& state, Corpus* corpus) {
+  for (const std::string& path : GetCorpusPaths()) {
+    std::unique_ptr<const ApkAssets> apk = ApkAssets::Load(path);
+    if (apk == nullptr) {
+      state.SkipWithError(base::StringPrintf("Failed to load assets %s", path.c_str()).c_str());
+      return false;
+    }
+    corpus->apk_assets_ptrs.push_back(apk.get());
+    corpus->apk_assets.push_back(std::move(apk));
+  }
+  if (corpus->apk_assets.empty()) {
+    state.SkipWithError("Empty corpus");
+    return false;
+  }
+  return true;
+}
+
+static bool GetCorpusResourceId(benchmark::State& state, const AssetManager2& assets,
+                                const char* name, uint32_t* out_resid) {
+  auto resid = assets.GetResourceId(name);
+  if (!resid.has_value()) {
+    state.SkipWithError(base::StringPrintf("Failed to find resource %s", name).c_str());
+    return false;
+  }
+  *out_resid = *resid;
+  return true;
+}
+
+// Each value is the mean of one repetition, so this is the slowest repetition rather than a
+// percentile of individual iterations.
+static double Max(const std::vector<double>& values) {
+  return *std::max_element(values.begin(), values.end());
+}
+
+static void CorpusStatistics(benchmark::internal::Benchmark* b) {
+  b->ComputeStatistics("max", Max);
+}
+
+static void BM_CorpusLoadApkAssets(benchmark::State& state) {
+  const std::vector<std::string> paths = GetCorpusPaths();
+  while (state.KeepRunning()) {
+    for (const std::string& path : paths) {
+      std::unique_ptr<const ApkAssets> apk = ApkAssets::Load(path);
+      if (apk == nullptr) {
+        state.SkipWithError(base::StringPrintf("Failed to load assets %s", path.c_str()).c_str());
+        return;
+      }
+      benchmark::DoNotOptimize(apk);
+    }
+  }
+}
+BENCHMARK(BM_CorpusLoadApkAssets)->Apply(CorpusStatistics);
+
+static void BM_CorpusSetApkAssets(benchmark::State& state) {
+  Corpus corpus;
+  if (!LoadCorpus(state, &corpus)) {
+    return;
+  }
+
+  while (state.KeepRunning()) {
+    AssetManager2 assets;
+    assets.SetApkAssets(corpus.apk_assets_ptrs);
+  }
+}
+BENCHMARK(BM_CorpusSetApkAssets)->Apply(CorpusStatistics);
+
+static void BM_CorpusSetConfiguration(benchmark::State& state) {
+  Corpus corpus;
+  if (!LoadCorpus(state, &corpus)) {
+    return;
+  }
+
+  AssetManager2 assets;
+  assets.SetApkAssets(corpus.apk_assets_ptrs);
+
+  // Alternate between two configurations so that every iteration invalidates the caches, the way
+  // a locale or density change does.
+  ResTable_config configs[2];
+  memset(configs, 0, sizeof(configs));
+  memcpy(configs[0].language, "en", 2);
+  memcpy(configs[0].country, "US", 2);
+  configs[0].density = ResTable_config::DENSITY_XHIGH;
+  memcpy(configs[1].language, "fr", 2);
+  memcpy(configs[1].country, "FR", 2);
+  configs[1].density = ResTable_config::DENSITY_XXHIGH;
+
+  size_t i = 0;
+  while (state.KeepRunning()) {
+    assets.SetConfiguration(configs[i++ & 1]);
+  }
+}
+BENCHMARK(BM_CorpusSetConfiguration)->Apply(CorpusStatistics);
+
+static void BM_CorpusGetResourceLocales(benchmark::State& state) {
+  Corpus corpus;
+  if (!LoadCorpus(state, &corpus)) {
+    return;
+  }
+
+  AssetManager2 assets;
+  assets.SetApkAssets(corpus.apk_assets_ptrs);
+
+  while (state.KeepRunning()) {
+    std::set<std::string> locales =
+        assets.GetResourceLocales(false /*exclude_system*/, true /*merge_equivalent_languages*/);
+    benchmark::DoNotOptimize(locales);
+  }
+}
+BENCHMARK(BM_CorpusGetResourceLocales)->Apply(CorpusStatistics);
+
+static void BM_CorpusGetBag(benchmark::State& state) {
+  Corpus corpus;
+  if (!LoadCorpus(state, &corpus)) {
+    return;
+  }
+
+  AssetManager2 assets;
+  assets.SetApkAssets(corpus.apk_assets_ptrs);
+  uint32_t style_id;
+  if (!GetCorpusResourceId(state, assets, kStyleName, &style_id)) {
+    return;
+  }
+
+  while (state.KeepRunning()) {
+    auto bag = assets.GetBag(style_id);
+    if (!bag.has_value()) {
+      state.SkipWithError("Failed to get bag");
+      return;
+    }
+    benchmark::DoNotOptimize(*bag);
+  }
+}
+BENCHMARK(BM_CorpusGetBag)->Apply(CorpusStatistics);
+
+static void BM_CorpusApplyStyle(benchmark::State& state) {
+  Corpus corpus;
+  if (!LoadCorpus(state, &corpus)) {
+    return;
+  }
+
+  AssetManager2 assets;
+  assets.SetApkAssets(corpus.apk_assets_ptrs);
+  uint32_t style_id;
+  if (!GetCorpusResourceId(state, assets, kStyleName, &style_id)) {
+    return;
+  }
+
+  while (state.KeepRunning()) {
+    auto theme = assets.NewTheme();
+    theme->ApplyStyle(style_id, false /* force */);
+  }
+}
+BENCHMARK(BM_CorpusApplyStyle)->Apply(CorpusStatistics);
+
+static void BM_CorpusFindEntry(benchmark::State& state) {
+  Corpus corpus;
+  if (!LoadCorpus(state, &corpus)) {
+    return;
+  }
+
+  AssetManager2 assets;
+  assets.SetApkAssets(corpus.apk_assets_ptrs);
+  uint32_t string_id;
+  if (!GetCorpusResourceId(state, assets, kStringName, &string_id)) {
+    return;
+  }
+
+  while (state.KeepRunning()) {
+    auto value = assets.GetResource(string_id);
+    benchmark::DoNotOptimize(value);
+  }
+}
+BENCHMARK(BM_CorpusFindEntry)->Apply(CorpusStatistics);
+
+static void BM_CorpusFindEntryByName(benchmark::State& state) {
+  Corpus corpus;
+  if (!LoadCorpus(state, &corpus)) {
+    return;
+  }
+
+  AssetManager2 assets;
+  assets.SetApkAssets(corpus.apk_assets_ptrs);
+
+  while (state.KeepRunning()) {
+    auto resid = assets.GetResourceId(kStringName);
+    benchmark::DoNotOptimize(resid);
+  }
+}
+BENCHMARK(BM_CorpusFindEntryByName)->Apply(CorpusStatistics);
+
+}  // namespace android
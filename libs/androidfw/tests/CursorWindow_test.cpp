@@ -101,6 +101,23 @@ TEST(CursorWindowTest, AllocRowBounds) {
     ASSERT_NE(w->allocRow(), OK);
 }
 
+TEST(CursorWindowTest, AllocRowWithHeapSize) {
+    CREATE_WINDOW_1K;
+
+    ASSERT_EQ(w->setNumColumns(4), OK);
+
+    // A row whose data can't fit is rejected without consuming any space
+    ASSERT_EQ(w->freeSpace(), 1 << 10);
+    ASSERT_NE(w->allocRowWithHeapSize(kGiantSize), OK);
+    ASSERT_EQ(w->getNumRows(), 0);
+    ASSERT_EQ(w->freeSpace(), 1 << 10);
+
+    ASSERT_EQ(w->allocRowWithHeapSize(CursorWindow::heapSizeOf(6)), OK);
+    ASSERT_EQ(w->getNumRows(), 1);
+    ASSERT_EQ(w->putString(0, 0, "cafe!", 6), OK);
+    ASSERT_EQ(w->freeSpace(), (1 << 10) - 64 - 8);
+}
+
 TEST(CursorWindowTest, StoreNull) {
     CREATE_WINDOW_1K_3X3;
 
@@ -101,18 +101,31 @@ float PathInterpolator::interpolate(float t) {
     } else if (t >= 1) {
         return 1;
     }
-    // Do a binary search for the correct x to interpolate between.
-    size_t startIndex = 0;
-    size_t endIndex = mX.size() - 1;
-
-    while (endIndex > startIndex + 1) {
-        int midIndex = (startIndex + endIndex) / 2;
-        if (t < mX[midIndex]) {
-            endIndex = midIndex;
-        } else {
-            startIndex = midIndex;
+    // mX is non-decreasing, so there is exactly one segment with
+    // mX[start] <= t < mX[start + 1]. Try the last segment and its successor
+    // before falling back to a binary search.
+    size_t startIndex = mLastIndex;
+    size_t endIndex = startIndex + 1;
+    if (endIndex < mX.size() && mX[startIndex] <= t && t < mX[endIndex]) {
+        // Same segment as last time.
+    } else if (endIndex + 1 < mX.size() && mX[endIndex] <= t && t < mX[endIndex + 1]) {
+        startIndex = endIndex;
+        endIndex = startIndex + 1;
+    } else {
+        // Do a binary search for the correct x to interpolate between.
+        startIndex = 0;
+        endIndex = mX.size() - 1;
+
+        while (endIndex > startIndex + 1) {
+            int midIndex = (startIndex + endIndex) / 2;
+            if (t < mX[midIndex]) {
+                endIndex = midIndex;
+            } else {
+                startIndex = midIndex;
+            }
         }
     }
+    mLastIndex = startIndex;
 
     float xRange = mX[endIndex] - mX[startIndex];
     if (xRange == 0) {
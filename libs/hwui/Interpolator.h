@@ -115,6 +115,9 @@ public:
 private:
     std::vector<float> mX;
     std::vector<float> mY;
+    // Segment found by the previous call. Animations sample monotonically, so the
+    // next input usually lands in the same or the following segment.
+    size_t mLastIndex = 0;
 };
 
 class LUTInterpolator : public Interpolator {
@@ -165,8 +165,21 @@ void JankTracker::calculateLegacyJank(FrameInfo& frame) REQUIRES(mDataMutex) {
 }
 
 void JankTracker::finishFrame(FrameInfo& frame, std::unique_ptr<FrameMetricsReporter>& reporter) {
-    std::lock_guard lock(mDataMutex);
+    {
+        std::lock_guard lock(mDataMutex);
+        if (!accumulateFrameLocked(frame)) {
+            return;
+        }
+    }
+
+    // Observers are notified outside of mDataMutex. It is shared by every JankTracker in the
+    // process and by dumpsys, and none of them need to wait on observer delivery.
+    if (CC_UNLIKELY(reporter.get() != nullptr)) {
+        reporter->reportFrameMetrics(frame.data(), false /* hasPresentTime */);
+    }
+}
 
+bool JankTracker::accumulateFrameLocked(FrameInfo& frame) REQUIRES(mDataMutex) {
     calculateLegacyJank(frame);
 
     // Fast-path for jank-free frames
@@ -179,7 +192,7 @@ void JankTracker::finishFrame(FrameInfo& frame, std::unique_ptr<FrameMetricsRepo
 
     // Only things like Surface.lockHardwareCanvas() are exempt from tracking
     if (CC_UNLIKELY(frame[FrameInfoIndex::Flags] & EXEMPT_FRAMES_FLAGS)) {
-        return;
+        return false;
     }
 
     int64_t frameInterval = frame[FrameInfoIndex::FrameInterval];
@@ -251,10 +264,7 @@ void JankTracker::finishFrame(FrameInfo& frame, std::unique_ptr<FrameMetricsRepo
         mData->reportGPUFrame(totalGPUDrawTime);
         (*mGlobalData)->reportGPUFrame(totalGPUDrawTime);
     }
-
-    if (CC_UNLIKELY(reporter.get() != nullptr)) {
-        reporter->reportFrameMetrics(frame.data(), false /* hasPresentTime */);
-    }
+    return true;
 }
 
 void JankTracker::recomputeThresholds(int64_t frameBudget) REQUIRES(mDataMutex) {
@@ -71,6 +71,9 @@ public:
     RingBuffer<FrameInfo, 120>& frames() { return mFrames; }
 
 private:
+    // Records the frame in mData and mGlobalData. Returns false if the frame is exempt from
+    // tracking and should not be reported to frame metrics observers either.
+    bool accumulateFrameLocked(FrameInfo& frame);
     void recomputeThresholds(int64_t frameInterval);
     static void dumpData(int fd, const ProfileDataDescription* description,
                          const ProfileData* data);
@@ -234,18 +234,20 @@ void PathParser::getPathDataFromAsciiString(PathData* data, ParseResult* result,
 
     while (end < strLen) {
         end = nextStart(pathStr, strLen, end);
-        std::vector<float> points;
-        getFloats(&points, result, pathStr, start, end);
-        validateVerbAndPoints(pathStr[start], points.size(), result);
+        // Parse the floats straight into the output rather than through a per-verb vector.
+        const size_t pointsStart = data->points.size();
+        getFloats(&data->points, result, pathStr, start, end);
+        const size_t pointCount = data->points.size() - pointsStart;
+        validateVerbAndPoints(pathStr[start], pointCount, result);
         if (result->failureOccurred) {
+            data->points.resize(pointsStart);
             // If either verb or points is not valid, return immediately.
             result->failureMessage += "Failure occurred at position " + std::to_string(start) +
                                       " of path: " + pathStr;
             return;
         }
         data->verbs.push_back(pathStr[start]);
-        data->verbSizes.push_back(points.size());
-        data->points.insert(data->points.end(), points.begin(), points.end());
+        data->verbSizes.push_back(pointCount);
         start = end;
         end++;
     }
@@ -93,6 +93,10 @@ void ProfileData::mergeWith(const ProfileData& other) {
         mFrameCounts[i] >>= divider;
         mFrameCounts[i] += other.mFrameCounts[i];
     }
+    for (size_t i = 0; i < other.mSlowFrameCounts.size(); i++) {
+        mSlowFrameCounts[i] >>= divider;
+        mSlowFrameCounts[i] += other.mSlowFrameCounts[i];
+    }
     mJankFrameCount >>= divider;
     mJankFrameCount += other.mJankFrameCount;
     mJankLegacyFrameCount >>= divider;
@@ -172,7 +176,7 @@ void ProfileData::reset() {
 void ProfileData::reportFrame(int64_t duration) {
     mTotalFrameCount++;
     uint32_t framebucket = frameCountIndexForFrameTime(duration);
-    if (framebucket <= mFrameCounts.size()) {
+    if (framebucket < mFrameCounts.size()) {
         mFrameCounts[framebucket]++;
     } else {
         framebucket = (ns2ms(duration) - kSlowFrameBucketStartMs) / kSlowFrameBucketIntervalMs;
@@ -74,6 +74,7 @@ bool Properties::forceDrawFrame = false;
 bool Properties::filterOutTestOverhead = false;
 bool Properties::disableVsync = false;
 bool Properties::skpCaptureEnabled = false;
+bool Properties::traceDisplayListOps = false;
 bool Properties::enableRTAnimations = true;
 
 bool Properties::runningInEmulator = false;
@@ -135,6 +136,8 @@ bool Properties::load() {
     SkAndroidFrameworkTraceUtil::setEnableTracing(
             base::GetBoolProperty(PROPERTY_SKIA_ATRACE_ENABLED, false));
 
+    traceDisplayListOps = base::GetBoolProperty(PROPERTY_TRACE_DISPLAY_LIST_OPS, false);
+
     runningInEmulator = base::GetBoolProperty(PROPERTY_IS_EMULATOR, false);
 
     useHintManager = base::GetBoolProperty(PROPERTY_USE_HINT_MANAGER, true);
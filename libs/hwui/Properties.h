@@ -147,6 +147,13 @@ enum DebugLevel {
  */
 #define PROPERTY_SKIA_ATRACE_ENABLED "debug.hwui.skia_atrace_enabled"
 
+/**
+ * Allows to record every display list op drawn by HWUI as a systrace slice named after the
+ * op type, so per-op counts and CPU time can be aggregated from a trace.
+ * Accepted values are "true" and "false". Default is false.
+ */
+#define PROPERTY_TRACE_DISPLAY_LIST_OPS "debug.hwui.trace_display_list_ops"
+
 /**
  * Defines how many frames in a sequence to capture.
  */
@@ -264,6 +271,8 @@ public:
 
     static bool skpCaptureEnabled;
 
+    static bool traceDisplayListOps;
+
     // For experimentation b/68769804
     static bool enableRTAnimations;
 
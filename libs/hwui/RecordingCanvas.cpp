@@ -17,7 +17,9 @@
 #include "RecordingCanvas.h"
 
 #include <GrRecordingContext.h>
+#include <utils/Trace.h>
 
+#include <algorithm>
 #include <experimental/type_traits>
 
 #include "SkAndroidFrameworkUtils.h"
@@ -35,6 +37,7 @@
 #include "SkRegion.h"
 #include "SkTextBlob.h"
 #include "SkVertices.h"
+#include "Properties.h"
 #include "VectorDrawable.h"
 #include "pipeline/skia/AnimatedDrawables.h"
 #include "pipeline/skia/FunctorDrawable.h"
@@ -589,8 +592,12 @@ void* DisplayListData::push(size_t pod, Args&&... args) {
     SkASSERT(skip < (1 << 24));
     if (fUsed + skip > fReserved) {
         static_assert(SkIsPow2(SKLITEDL_PAGE), "This math needs updating for non-pow2.");
+        // Grow by at least half again so that recording a large list costs a logarithmic
+        // number of reallocs and copies rather than one per page. The buffer is kept across
+        // reset(), so re-recording a reused list of similar size doesn't realloc at all.
+        size_t needed = std::max(fUsed + skip, fReserved + fReserved / 2);
         // Next greater multiple of SKLITEDL_PAGE.
-        fReserved = (fUsed + skip + SKLITEDL_PAGE) & ~(SKLITEDL_PAGE - 1);
+        fReserved = (needed + SKLITEDL_PAGE) & ~(SKLITEDL_PAGE - 1);
         fBytes.realloc(fReserved);
         LOG_ALWAYS_FATAL_IF(fBytes.get() == nullptr, "realloc(%zd) failed", fReserved);
     }
@@ -786,6 +793,18 @@ static const draw_fn draw_fns[] = {
 };
 #undef X
 
+// Same as draw_fns, but wraps each op in a trace section named after its type. Only used when
+// Properties::traceDisplayListOps is set, so the regular draw loop pays nothing for it.
+#define X(T)                                                    \
+    [](const void* op, SkCanvas* c, const SkMatrix& original) { \
+        ATRACE_NAME(#T);                                        \
+        ((const T*)op)->draw(c, original);                      \
+    },
+static const draw_fn traced_draw_fns[] = {
+#include "DisplayListOps.in"
+};
+#undef X
+
 // Most state ops (matrix, clip, save, restore) have a trivial destructor.
 #define X(T)                                                                                 \
     !std::is_trivially_destructible<T>::value ? [](const void* op) { ((const T*)op)->~T(); } \
@@ -798,6 +817,10 @@ static const void_fn dtor_fns[] = {
 
 void DisplayListData::draw(SkCanvas* canvas) const {
     SkAutoCanvasRestore acr(canvas, false);
+    if (CC_UNLIKELY(Properties::traceDisplayListOps && ATRACE_ENABLED())) {
+        this->map(traced_draw_fns, canvas, canvas->getTotalMatrix());
+        return;
+    }
     this->map(draw_fns, canvas, canvas->getTotalMatrix());
 }
 
@@ -227,10 +227,14 @@ void RenderNode::prepareTreeImpl(TreeObserver& observer, TreeInfo& info, bool fu
         pushStagingPropertiesChanges(info);
     }
 
-    if (!mProperties.getAllowForceDark()) {
+    // Sample these once so the counters are restored exactly, even if an animator or
+    // position listener below changes the properties mid-traversal.
+    const bool disablesForceDark = !mProperties.getAllowForceDark();
+    const bool hasStretchEffect = !mProperties.layerProperties().getStretchEffect().isEmpty();
+    if (disablesForceDark) {
         info.disableForceDark++;
     }
-    if (!mProperties.layerProperties().getStretchEffect().isEmpty()) {
+    if (hasStretchEffect) {
         info.stretchEffectCount++;
     }
 
@@ -275,10 +279,10 @@ void RenderNode::prepareTreeImpl(TreeObserver& observer, TreeInfo& info, bool fu
     }
     pushLayerUpdate(info);
 
-    if (!mProperties.getAllowForceDark()) {
+    if (disablesForceDark) {
         info.disableForceDark--;
     }
-    if (!mProperties.layerProperties().getStretchEffect().isEmpty()) {
+    if (hasStretchEffect) {
         info.stretchEffectCount--;
     }
     info.damageAccumulator->popTransform();
@@ -160,6 +160,8 @@ public:
     public:
         explicit filtered_iterator(uint8_t* start, const uint8_t* end)
                 : mCurrent(start), mEnd(end) {
+            // An empty range has no header to inspect
+            if (mCurrent == mEnd) return;
             ItemHeader* header = reinterpret_cast<ItemHeader*>(mCurrent);
             if (header->type != T) {
                 advance();
@@ -211,6 +213,7 @@ public:
 
     template <ItemTypes T>
     filtered_view<T> filter() const {
+        if (!mBuffer) return filtered_view<T>{nullptr, nullptr};
         return filtered_view<T>{start_ptr(), end_ptr()};
     }
 
@@ -206,12 +206,15 @@ sk_sp<SkShader> StretchEffect::getShader(float width, float height,
 
     if (mBuilder == nullptr) {
         mBuilder = std::make_unique<SkRuntimeShaderBuilder>(getStretchEffect());
+        // These uniforms never change, the builder keeps their values between shaders.
+        mBuilder->uniform("uInterpolationStrength").set(&INTERPOLATION_STRENGTH_VALUE, 1);
+        mBuilder->uniform("uScrollX").set(&ZERO, 1);
+        mBuilder->uniform("uScrollY").set(&ZERO, 1);
     }
 
     mBuilder->child(CONTENT_TEXTURE) =
             snapshotImage->makeShader(SkTileMode::kClamp, SkTileMode::kClamp,
                                       SkSamplingOptions(SkFilterMode::kLinear), matrix);
-    mBuilder->uniform("uInterpolationStrength").set(&INTERPOLATION_STRENGTH_VALUE, 1);
     mBuilder->uniform("uStretchAffectedDistX").set(&width, 1);
     mBuilder->uniform("uStretchAffectedDistY").set(&height, 1);
     mBuilder->uniform("uDistanceStretchedX").set(&distanceStretchedX, 1);
@@ -222,8 +225,6 @@ sk_sp<SkShader> StretchEffect::getShader(float width, float height,
     mBuilder->uniform("uDistDiffY").set(&diffY, 1);
     mBuilder->uniform("uOverscrollX").set(&normOverScrollDistX, 1);
     mBuilder->uniform("uOverscrollY").set(&normOverScrollDistY, 1);
-    mBuilder->uniform("uScrollX").set(&ZERO, 1);
-    mBuilder->uniform("uScrollY").set(&ZERO, 1);
     mBuilder->uniform("viewportWidth").set(&width, 1);
     mBuilder->uniform("viewportHeight").set(&height, 1);
 
@@ -22,26 +22,35 @@ namespace android {
 namespace uirenderer {
 
 AnimatedImageThread& AnimatedImageThread::getInstance() {
-    static sp<AnimatedImageThread> sInstance = []() {
-        sp<AnimatedImageThread> thread = sp<AnimatedImageThread>::make();
-        thread->start("AnimatedImageThread");
-        return thread;
-    }();
+    static AnimatedImageThread* sInstance = new AnimatedImageThread();
     return *sInstance;
 }
 
-AnimatedImageThread::AnimatedImageThread() {
+status_t AnimatedImageThread::Worker::readyToRun() {
     setpriority(PRIO_PROCESS, 0, PRIORITY_NORMAL + PRIORITY_MORE_FAVORABLE);
+    return NO_ERROR;
+}
+
+WorkQueue& AnimatedImageThread::queueFor(const sk_sp<AnimatedImageDrawable>& drawable) {
+    // Drawables are heap allocated, so the low bits of the address carry no information.
+    const size_t index = (reinterpret_cast<uintptr_t>(drawable.get()) >> 4) % kWorkerCount;
+    std::lock_guard lock{mLock};
+    sp<Worker>& worker = mWorkers[index];
+    if (!worker) {
+        worker = sp<Worker>::make();
+        worker->start("AnimatedImageThread");
+    }
+    return worker->queue();
 }
 
 std::future<AnimatedImageDrawable::Snapshot> AnimatedImageThread::decodeNextFrame(
         const sk_sp<AnimatedImageDrawable>& drawable) {
-    return queue().async([drawable]() { return drawable->decodeNextFrame(); });
+    return queueFor(drawable).async([drawable]() { return drawable->decodeNextFrame(); });
 }
 
 std::future<AnimatedImageDrawable::Snapshot> AnimatedImageThread::reset(
         const sk_sp<AnimatedImageDrawable>& drawable) {
-    return queue().async([drawable]() { return drawable->reset(); });
+    return queueFor(drawable).async([drawable]() { return drawable->reset(); });
 }
 
 }  // namespace uirenderer
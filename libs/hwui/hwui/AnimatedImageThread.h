@@ -22,11 +22,21 @@
 
 #include <SkRefCnt.h>
 
+#include <array>
+#include <mutex>
+
 namespace android {
 
 namespace uirenderer {
 
-class AnimatedImageThread : private ThreadBase {
+/**
+ * Decodes animated image frames off the RenderThread.
+ *
+ * Work is spread over a small set of decode threads so that several animated images on screen
+ * do not queue up behind each other. A given drawable is always served by the same thread,
+ * which keeps its reset and decode requests in the order they were made.
+ */
+class AnimatedImageThread {
     PREVENT_COPY_AND_ASSIGN(AnimatedImageThread);
 
 public:
@@ -37,8 +47,20 @@ public:
     std::future<AnimatedImageDrawable::Snapshot> reset(const sk_sp<AnimatedImageDrawable>&);
 
 private:
-    friend sp<AnimatedImageThread>;
-    AnimatedImageThread();
+    class Worker : public ThreadBase {
+    protected:
+        virtual status_t readyToRun() override;
+    };
+
+    static constexpr size_t kWorkerCount = 2;
+
+    AnimatedImageThread() {}
+
+    // Returns the worker for this drawable, starting it on first use.
+    WorkQueue& queueFor(const sk_sp<AnimatedImageDrawable>& drawable);
+
+    std::mutex mLock;
+    std::array<sp<Worker>, kWorkerCount> mWorkers;
 };
 
 }  // namespace uirenderer
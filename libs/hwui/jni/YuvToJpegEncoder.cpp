@@ -85,7 +85,6 @@ Yuv420SpToJpegEncoder::Yuv420SpToJpegEncoder(int* strides) :
 
 void Yuv420SpToJpegEncoder::compress(jpeg_compress_struct* cinfo,
         uint8_t* yuv, int* offsets) {
-    SkDebugf("onFlyCompress");
     JSAMPROW y[16];
     JSAMPROW cb[8];
     JSAMPROW cr[8];
@@ -131,14 +130,17 @@ void Yuv420SpToJpegEncoder::deinterleave(uint8_t* vuPlanar, uint8_t* uRows,
         uint8_t* vRows, int rowIndex, int width, int height) {
     int numRows = (height - rowIndex) / 2;
     if (numRows > 8) numRows = 8;
+    const int halfWidth = width >> 1;
     for (int row = 0; row < numRows; ++row) {
         int offset = ((rowIndex >> 1) + row) * fStrides[1];
-        uint8_t* vu = vuPlanar + offset;
-        for (int i = 0; i < (width >> 1); ++i) {
-            int index = row * (width >> 1) + i;
-            uRows[index] = vu[1];
-            vRows[index] = vu[0];
-            vu += 2;
+        const uint8_t* __restrict vu = vuPlanar + offset;
+        uint8_t* __restrict uRow = uRows + row * halfWidth;
+        uint8_t* __restrict vRow = vRows + row * halfWidth;
+        // Plain indexed loop over non-aliasing rows, so the compiler can turn it into
+        // interleaved vector loads.
+        for (int i = 0; i < halfWidth; ++i) {
+            uRow[i] = vu[2 * i + 1];
+            vRow[i] = vu[2 * i];
         }
     }
 }
@@ -161,7 +163,6 @@ Yuv422IToJpegEncoder::Yuv422IToJpegEncoder(int* strides) :
 
 void Yuv422IToJpegEncoder::compress(jpeg_compress_struct* cinfo,
         uint8_t* yuv, int* offsets) {
-    SkDebugf("onFlyCompress_422");
     JSAMPROW y[16];
     JSAMPROW cb[16];
     JSAMPROW cr[16];
@@ -206,16 +207,17 @@ void Yuv422IToJpegEncoder::deinterleave(uint8_t* yuv, uint8_t* yRows, uint8_t* u
         uint8_t* vRows, int rowIndex, int width, int height) {
     int numRows = height - rowIndex;
     if (numRows > 16) numRows = 16;
+    const int halfWidth = width >> 1;
     for (int row = 0; row < numRows; ++row) {
-        uint8_t* yuvSeg = yuv + (rowIndex + row) * fStrides[0];
-        for (int i = 0; i < (width >> 1); ++i) {
-            int indexY = row * width + (i << 1);
-            int indexU = row * (width >> 1) + i;
-            yRows[indexY] = yuvSeg[0];
-            yRows[indexY + 1] = yuvSeg[2];
-            uRows[indexU] = yuvSeg[1];
-            vRows[indexU] = yuvSeg[3];
-            yuvSeg += 4;
+        const uint8_t* __restrict yuvSeg = yuv + (rowIndex + row) * fStrides[0];
+        uint8_t* __restrict yRow = yRows + row * width;
+        uint8_t* __restrict uRow = uRows + row * halfWidth;
+        uint8_t* __restrict vRow = vRows + row * halfWidth;
+        for (int i = 0; i < halfWidth; ++i) {
+            yRow[2 * i] = yuvSeg[4 * i];
+            yRow[2 * i + 1] = yuvSeg[4 * i + 2];
+            uRow[i] = yuvSeg[4 * i + 1];
+            vRow[i] = yuvSeg[4 * i + 3];
         }
     }
 }
@@ -22,6 +22,8 @@
 #include <SkPathOps.h>
 #include <SkShadowUtils.h>
 
+#include <algorithm>
+
 namespace android {
 namespace uirenderer {
 namespace skiapipeline {
@@ -39,12 +41,17 @@ void StartReorderBarrierDrawable::onDraw(SkCanvas* canvas) {
             mChildren.push_back(const_cast<RenderNodeDrawable*>(&mDisplayList->mChildNodes[i]));
         }
     }
-    std::stable_sort(mChildren.begin(), mChildren.end(),
-                     [](RenderNodeDrawable* a, RenderNodeDrawable* b) {
-                         const float aZValue = a->getNodeProperties().getZ();
-                         const float bZValue = b->getNodeProperties().getZ();
-                         return aZValue < bZValue;
-                     });
+    auto compareZ = [](RenderNodeDrawable* a, RenderNodeDrawable* b) {
+        const float aZValue = a->getNodeProperties().getZ();
+        const float bZValue = b->getNodeProperties().getZ();
+        return aZValue < bZValue;
+    };
+    // mChildren keeps the order from the previous draw, and Z values rarely change between
+    // frames. Skip the stable_sort (and its temporary buffer) when the order is still valid;
+    // stable sorting an already sorted range would not move anything.
+    if (!std::is_sorted(mChildren.begin(), mChildren.end(), compareZ)) {
+        std::stable_sort(mChildren.begin(), mChildren.end(), compareZ);
+    }
 
     size_t drawIndex = 0;
     const size_t endIndex = mChildren.size();
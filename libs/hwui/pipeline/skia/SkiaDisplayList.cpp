@@ -109,13 +109,22 @@ bool SkiaDisplayList::prepareListAndChildren(
 
     for (auto& child : mChildNodes) {
         RenderNode* childNode = child.getRenderNode();
-        Matrix4 mat4(child.getRecordedMatrix());
-        info.damageAccumulator->pushTransform(&mat4);
+        // Most children are recorded without a canvas transform. Damage maps through an
+        // identity matrix unchanged, so skip converting it and pushing a frame for it.
+        const SkMatrix& recordedMatrix = child.getRecordedMatrix();
+        const bool hasRecordedTransform = !recordedMatrix.isIdentity();
+        Matrix4 mat4;
+        if (hasRecordedTransform) {
+            mat4.load(recordedMatrix);
+            info.damageAccumulator->pushTransform(&mat4);
+        }
         info.hasBackwardProjectedNodes = false;
         childFn(childNode, observer, info, functorsNeedLayer);
         hasBackwardProjectedNodesHere |= child.getNodeProperties().getProjectBackwards();
         hasBackwardProjectedNodesSubtree |= info.hasBackwardProjectedNodes;
-        info.damageAccumulator->popTransform();
+        if (hasRecordedTransform) {
+            info.damageAccumulator->popTransform();
+        }
     }
 
     // The purpose of next block of code is to reset projected display list if there are no
@@ -174,8 +183,8 @@ void SkiaDisplayList::reset() {
     mChildFunctors.clear();
     mChildNodes.clear();
 
-    allocator.~LinearAllocator();
-    new (&allocator) LinearAllocator();
+    // Keep the allocator's largest page; this list is about to be re-recorded.
+    allocator.reset();
 }
 
 void SkiaDisplayList::output(std::ostream& output, uint32_t level) const {
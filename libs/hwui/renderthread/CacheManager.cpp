@@ -44,6 +44,11 @@ namespace renderthread {
 // be ARGB_8888.
 #define SURFACE_SIZE_MULTIPLIER (12.0f * 4.0f)
 #define BACKGROUND_RETENTION_PERCENTAGE (0.5f)
+// Deferred cleanup purges resources that have been idle for at least 10 seconds, so scanning
+// the resource cache for them on every frame buys nothing over doing so once a second.
+#define DEFERRED_CLEANUP_INTERVAL (1_s)
+// Querying the resource cache totals is cheap, but there is no need to do it every frame.
+#define GPU_USAGE_SAMPLE_FRAMES (60)
 
 CacheManager::CacheManager()
         : mMaxSurfaceArea(DeviceInfo::getWidth() * DeviceInfo::getHeight())
@@ -196,6 +201,16 @@ void CacheManager::dumpMemoryUsage(String8& log, const RenderState* renderState)
 
     log.appendFormat("Total GPU memory usage:\n");
     gpuTracer.logTotals(log);
+
+    if (mGpuUsageSampleTotal > 0) {
+        log.appendFormat("Recent GPU cache usage (every %d frames, oldest first):\n ",
+                         GPU_USAGE_SAMPLE_FRAMES);
+        const size_t count = std::min(mGpuUsageSampleTotal, kGpuUsageSampleCount);
+        for (size_t i = mGpuUsageSampleTotal - count; i < mGpuUsageSampleTotal; i++) {
+            log.appendFormat(" %.2f", mGpuUsageSamples[i % kGpuUsageSampleCount] / 1024.0f);
+        }
+        log.appendFormat(" KB\n");
+    }
 }
 
 void CacheManager::onFrameCompleted() {
@@ -208,10 +223,33 @@ void CacheManager::onFrameCompleted() {
         }
         tracer.logTraces();
     }
+
+    if (mGrContext && ++mFramesSinceGpuUsageSample >= GPU_USAGE_SAMPLE_FRAMES) {
+        mFramesSinceGpuUsageSample = 0;
+        size_t bytes = 0;
+        mGrContext->getResourceCacheUsage(nullptr, &bytes);
+        mGpuUsageSamples[mGpuUsageSampleTotal % kGpuUsageSampleCount] = bytes;
+        mGpuUsageSampleTotal++;
+    }
+}
+
+bool CacheManager::shouldScheduleDeferredCleanup() {
+    if (mDeferredCleanupPending ||
+        systemTime(SYSTEM_TIME_MONOTONIC) - mLastDeferredCleanup < DEFERRED_CLEANUP_INTERVAL) {
+        return false;
+    }
+    mDeferredCleanupPending = true;
+    return true;
 }
 
 void CacheManager::performDeferredCleanup(nsecs_t cleanupOlderThanMillis) {
+    mDeferredCleanupPending = false;
     if (mGrContext) {
+        nsecs_t now = systemTime(SYSTEM_TIME_MONOTONIC);
+        if (now - mLastDeferredCleanup < DEFERRED_CLEANUP_INTERVAL) {
+            return;
+        }
+        mLastDeferredCleanup = now;
         mGrContext->performDeferredCleanup(
             std::chrono::milliseconds(cleanupOlderThanMillis),
             /* scratchResourcesOnly */true);
@@ -22,6 +22,7 @@
 #endif
 #include <SkSurface.h>
 #include <utils/String8.h>
+#include <array>
 #include <vector>
 #include "utils/TimeUtils.h"
 
@@ -54,6 +55,9 @@ public:
     size_t getBackgroundCacheSize() const { return mBackgroundResourceBytes; }
     void onFrameCompleted();
 
+    // Returns true if the caller should post a performDeferredCleanup() call. At most one is
+    // outstanding at a time, and none is requested before the cleanup interval has passed.
+    bool shouldScheduleDeferredCleanup();
     void performDeferredCleanup(nsecs_t cleanupOlderThanMillis);
 
 private:
@@ -77,6 +81,16 @@ private:
     const size_t mMaxGpuFontAtlasBytes;
     const size_t mMaxCpuFontCacheBytes;
     const size_t mBackgroundCpuFontCacheBytes;
+
+    nsecs_t mLastDeferredCleanup = 0;
+    bool mDeferredCleanupPending = false;
+
+    // Resource cache usage sampled every GPU_USAGE_SAMPLE_FRAMES frames, reported by
+    // dumpMemoryUsage so growth over time is visible without a trace capture.
+    static constexpr size_t kGpuUsageSampleCount = 32;
+    std::array<size_t, kGpuUsageSampleCount> mGpuUsageSamples = {};
+    size_t mGpuUsageSampleTotal = 0;
+    uint32_t mFramesSinceGpuUsageSample = 0;
 };
 
 } /* namespace renderthread */
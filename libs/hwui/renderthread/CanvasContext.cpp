@@ -634,13 +634,19 @@ void CanvasContext::cleanupResources() {
     auto& tracker = mJankTracker.frames();
     auto size = tracker.size();
     auto capacity = tracker.capacity();
-    if (size == capacity) {
+    if (size == capacity && mRenderThread.cacheManager().shouldScheduleDeferredCleanup()) {
         nsecs_t nowNanos = systemTime(SYSTEM_TIME_MONOTONIC);
         nsecs_t frameCompleteNanos =
             tracker[0].get(FrameInfoIndex::FrameCompleted);
         nsecs_t frameDiffNanos = nowNanos - frameCompleteNanos;
         nsecs_t cleanupMillis = ns2ms(std::max(frameDiffNanos, 10_s));
-        mRenderThread.cacheManager().performDeferredCleanup(cleanupMillis);
+        // This is housekeeping rather than part of the frame, so run it after the current
+        // frame task instead of inside it. That keeps it out of the frame's critical path
+        // and out of the work duration reported to the performance hint session.
+        RenderThread* renderThread = &mRenderThread;
+        renderThread->queue().post([renderThread, cleanupMillis]() {
+            renderThread->cacheManager().performDeferredCleanup(cleanupMillis);
+        });
     }
 }
 
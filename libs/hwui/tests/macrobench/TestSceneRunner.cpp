@@ -28,6 +28,9 @@
 #include <log/log.h>
 #include <ui/PixelFormat.h>
 
+#include <algorithm>
+#include <vector>
+
 // These are unstable internal APIs in google-benchmark. We should just implement our own variant
 // of these instead, but this was quicker. Disabled-by-default to avoid any breakages when
 // google-benchmark updates if they change anything
@@ -78,8 +81,16 @@ private:
 
 using BenchmarkResults = std::vector<benchmark::BenchmarkReporter::Run>;
 
+// Returns the given percentile of the frame times, which are reordered in the process.
+static double frameTimePercentile(std::vector<double>& frameTimesMs, int percentile) {
+    auto nth = frameTimesMs.begin() + (frameTimesMs.size() - 1) * percentile / 100;
+    std::nth_element(frameTimesMs.begin(), nth, frameTimesMs.end());
+    return *nth;
+}
+
 void outputBenchmarkReport(const TestScene::Info& info, const TestScene::Options& opts,
-                           double durationInS, int repetationIndex, BenchmarkResults* reports) {
+                           double durationInS, int repetationIndex,
+                           std::vector<double>& frameTimesMs, BenchmarkResults* reports) {
     using namespace benchmark;
     benchmark::BenchmarkReporter::Run report;
     report.repetitions = opts.repeatCount;
@@ -89,6 +100,11 @@ void outputBenchmarkReport(const TestScene::Info& info, const TestScene::Options
     report.real_accumulated_time = durationInS;
     report.cpu_accumulated_time = durationInS;
     report.counters["FPS"] = opts.frameCount / durationInS;
+    if (!frameTimesMs.empty()) {
+        report.counters["50th ms"] = frameTimePercentile(frameTimesMs, 50);
+        report.counters["90th ms"] = frameTimePercentile(frameTimesMs, 90);
+        report.counters["99th ms"] = frameTimePercentile(frameTimesMs, 99);
+    }
     if (opts.reportGpuMemoryUsage) {
         size_t cpuUsage, gpuUsage;
         RenderProxy::getMemoryUsage(&cpuUsage, &gpuUsage);
@@ -151,6 +167,10 @@ static void doRun(const TestScene::Info& info, const TestScene::Options& opts, i
     proxy->fence();
 
     ModifiedMovingAverage<double> avgMs(opts.reportFrametimeWeight);
+    std::vector<double> frameTimesMs;
+    if (opts.reportFrametimeWeight) {
+        frameTimesMs.reserve(opts.frameCount);
+    }
 
     nsecs_t start = systemTime(SYSTEM_TIME_MONOTONIC);
     for (int i = 0; i < opts.frameCount; i++) {
@@ -168,7 +188,9 @@ static void doRun(const TestScene::Info& info, const TestScene::Options& opts, i
         if (opts.reportFrametimeWeight) {
             proxy->fence();
             nsecs_t done = systemTime(SYSTEM_TIME_MONOTONIC);
-            avgMs.add((done - vsync) / 1000000.0);
+            const double frameTimeMs = (done - vsync) / 1000000.0;
+            frameTimesMs.push_back(frameTimeMs);
+            avgMs.add(frameTimeMs);
             if (i % 10 == 9) {
                 printf("Average frametime %.3fms\n", avgMs.average());
             }
@@ -179,7 +201,7 @@ static void doRun(const TestScene::Info& info, const TestScene::Options& opts, i
 
     if (reports) {
         outputBenchmarkReport(info, opts, (end - start) / (double)s2ns(1), repetitionIndex,
-                              reports);
+                              frameTimesMs, reports);
     } else {
         proxy->dumpProfileInfo(STDOUT_FILENO, DumpFlags::JankStats);
     }
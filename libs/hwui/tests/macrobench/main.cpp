@@ -62,7 +62,9 @@ OPTIONS:
                        next frame. Note that without locked clocks this will
                        pathologically bad performance due to large idle time
   --report-frametime[=weight] If set, the test will print to stdout the
-                       moving average frametime. Weight is optional, default is 10
+                       moving average frametime. Weight is optional, default is 10.
+                       Benchmark reports then also include 50th, 90th and 99th
+                       percentile frametimes
   --cpuset=name        Adds the test to the specified cpuset before running
                        Not supported on all devices and needs root
   --offscreen          Render tests off device screen. This option is on by default
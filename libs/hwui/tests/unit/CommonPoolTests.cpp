@@ -36,6 +36,15 @@ TEST(CommonPool, post) {
     EXPECT_TRUE(ran) << "Failed to flip atomic after 1 second";
 }
 
+TEST(CommonPool, tryPost) {
+    std::atomic_bool ran(false);
+    ASSERT_TRUE(CommonPool::tryPost([&ran] { ran = true; }));
+    for (int i = 0; !ran && i < 1000; i++) {
+        usleep(1);
+    }
+    EXPECT_TRUE(ran) << "Failed to flip atomic after 1 second";
+}
+
 // test currently relies on timings, which
 // makes it flaky. Disable for now
 TEST(DISABLED_CommonPool, threadCount) {
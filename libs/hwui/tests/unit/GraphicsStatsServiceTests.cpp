@@ -18,6 +18,7 @@
 
 #include "protos/graphicsstats.pb.h"
 #include "service/GraphicsStatsService.h"
+#include "utils/TimeUtils.h"
 
 #include <stdio.h>
 #include <stdlib.h>
@@ -160,3 +161,29 @@ TEST(GraphicsStats, merge) {
         EXPECT_EQ(expectedBucket, loadedProto.histogram().Get(i).render_millis());
     }
 }
+
+TEST(ProfileData, mergeWithSlowFrames) {
+    MockProfileData data;
+    MockProfileData other;
+    data.reset();
+    other.reset();
+    data.editSlowFrameCounts()[3] = 2;
+    other.editSlowFrameCounts()[3] = 5;
+    other.editSlowFrameCounts()[96] = 1;
+    data.mergeWith(other);
+    EXPECT_EQ(7, data.editSlowFrameCounts()[3]);
+    EXPECT_EQ(1, data.editSlowFrameCounts()[96]);
+}
+
+TEST(ProfileData, reportFrameFastBucketBoundary) {
+    MockProfileData data;
+    data.reset();
+    // 136ms is past the last fast bucket and must land in the first slow bucket instead of
+    // writing past the end of the fast histogram.
+    data.reportFrame(136_ms);
+    EXPECT_EQ(1u, data.totalFrameCount());
+    EXPECT_EQ(1, data.editSlowFrameCounts()[0]);
+    for (auto count : data.editFrameCounts()) {
+        EXPECT_EQ(0u, count);
+    }
+}
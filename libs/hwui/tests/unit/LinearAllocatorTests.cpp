@@ -86,6 +86,30 @@ TEST(LinearAllocator, rewind) {
     EXPECT_EQ(1, destroyed);
 }
 
+TEST(LinearAllocator, reset) {
+    int destroyed[2] = {0};
+    LinearAllocator la;
+    la.create<TestUtils::SignalingDtor>(destroyed);
+    la.alloc<char>(100);
+    // Big enough to get a dedicated page
+    la.alloc<char>(4096);
+    size_t allocatedBefore = la.allocatedSize();
+
+    la.reset();
+    EXPECT_EQ(1, destroyed[0]);
+    EXPECT_LT(0u, la.allocatedSize());
+    EXPECT_GT(allocatedBefore, la.allocatedSize());
+
+    // The kept page is reused rather than allocating a new one
+    size_t allocatedAfterReset = la.allocatedSize();
+    la.create<TestUtils::SignalingDtor>(destroyed + 1);
+    EXPECT_EQ(allocatedAfterReset, la.allocatedSize());
+    EXPECT_EQ(0, destroyed[1]);
+
+    la.reset();
+    EXPECT_EQ(1, destroyed[1]);
+}
+
 TEST(LinearStdAllocator, simpleAllocate) {
     LinearAllocator la;
     LinearStdAllocator<void*> stdAllocator(la);
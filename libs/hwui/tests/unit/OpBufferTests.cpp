@@ -188,3 +188,27 @@ TEST(OpBuffer, filterView) {
     EXPECT_EQ(count, 7);
 }
 
+TEST(OpBuffer, filterViewEmpty) {
+    MockBuffer buffer;
+    int count = 0;
+    for (const auto& it : buffer.filter<Op::IntHolder>()) {
+        (void)it;
+        count++;
+    }
+    EXPECT_EQ(count, 0);
+
+    buffer.push<Op::NoOp>({});
+    buffer.clear();
+    for (const auto& it : buffer.filter<Op::IntHolder>()) {
+        (void)it;
+        count++;
+    }
+    EXPECT_EQ(count, 0);
+
+    buffer.push<Op::NoOp>({});
+    for (const auto& it : buffer.filter<Op::IntHolder>()) {
+        (void)it;
+        count++;
+    }
+    EXPECT_EQ(count, 0);
+}
@@ -86,5 +86,18 @@ TEST(Interpolator, pathInterpolation) {
         }
     }
 }
+
+TEST(Interpolator, pathInterpolationOutOfOrder) {
+    for (const TestData& data : sTestDataSet) {
+        PathInterpolator interpolator(getX(data), getY(data));
+        // Walk backwards, then forwards again, so lookups start from a stale segment.
+        for (size_t i = data.inFraction.size(); i-- > 0;) {
+            EXPECT_FLOAT_EQ(data.outFraction[i], interpolator.interpolate(data.inFraction[i]));
+        }
+        for (size_t i = 0; i < data.inFraction.size(); i += 2) {
+            EXPECT_FLOAT_EQ(data.outFraction[i], interpolator.interpolate(data.inFraction[i]));
+        }
+    }
+}
 }
 }
@@ -80,6 +80,10 @@ std::vector<int> CommonPool::getThreadIds() {
     return instance().mWorkerThreadIds;
 }
 
+bool CommonPool::tryPost(Task&& task) {
+    return instance().tryEnqueue(std::move(task));
+}
+
 void CommonPool::enqueue(Task&& task) {
     std::unique_lock lock(mLock);
     while (!mWorkQueue.hasSpace()) {
@@ -87,7 +91,21 @@ void CommonPool::enqueue(Task&& task) {
         usleep(100);
         lock.lock();
     }
+    pushLocked(std::move(task));
+}
+
+bool CommonPool::tryEnqueue(Task&& task) {
+    std::unique_lock lock(mLock);
+    if (!mWorkQueue.hasSpace()) {
+        return false;
+    }
+    pushLocked(std::move(task));
+    return true;
+}
+
+void CommonPool::pushLocked(Task&& task) {
     mWorkQueue.push(std::move(task));
+    ATRACE_INT("CommonPool queue depth", mWorkQueue.size());
     if (mWaitingThreads == THREAD_COUNT || (mWaitingThreads > 0 && mWorkQueue.size() > 1)) {
         mCondition.notify_one();
     }
@@ -42,13 +42,7 @@ public:
     constexpr size_t capacity() const { return SIZE; }
     constexpr bool hasWork() const { return mHead != mTail; }
     constexpr bool hasSpace() const { return ((mHead + 1) % SIZE) != mTail; }
-    constexpr int size() const {
-        if (mHead > mTail) {
-            return mHead - mTail;
-        } else {
-            return mTail - mHead + SIZE;
-        }
-    }
+    constexpr int size() const { return (mHead - mTail + SIZE) % SIZE; }
 
     constexpr void push(T&& t) {
         int newHead = (mHead + 1) % SIZE;
@@ -83,6 +77,10 @@ public:
 
     static void post(Task&& func);
 
+    // Like post(), but returns false instead of waiting for space if the work queue is
+    // full. Lets callers on latency-sensitive threads run the task inline instead.
+    static bool tryPost(Task&& func);
+
     template <class F>
     static auto async(F&& func) -> std::future<decltype(func())> {
         typedef std::packaged_task<decltype(func())()> task_t;
@@ -110,6 +108,9 @@ private:
     ~CommonPool() {}
 
     void enqueue(Task&&);
+    bool tryEnqueue(Task&&);
+    // Requires mLock to be held and the queue to have space
+    void pushLocked(Task&&);
     void doWaitForIdle();
 
     void workerLoop();
@@ -105,19 +105,56 @@ LinearAllocator::LinearAllocator()
         , mDedicatedPageCount(0) {}
 
 LinearAllocator::~LinearAllocator(void) {
+    runDestructors();
+    Page* p = mPages;
+    while (p) {
+        Page* next = p->next();
+        p->~Page();
+        free(p);
+        RM_ALLOCATION();
+        p = next;
+    }
+}
+
+void LinearAllocator::runDestructors() {
     while (mDtorList) {
         auto node = mDtorList;
         mDtorList = node->next;
         node->dtor(node->addr);
     }
+}
+
+void LinearAllocator::reset() {
+    runDestructors();
+
+    // mNext is only set while mCurrentPage is a regular page of mPageSize, which is
+    // also the largest regular page, so keep that one and free the rest.
+    Page* keep = mNext ? mCurrentPage : nullptr;
     Page* p = mPages;
     while (p) {
         Page* next = p->next();
-        p->~Page();
-        free(p);
-        RM_ALLOCATION();
+        if (p != keep) {
+            p->~Page();
+            free(p);
+            RM_ALLOCATION();
+        }
         p = next;
     }
+
+    mPages = mCurrentPage = keep;
+    mDedicatedPageCount = 0;
+    if (keep) {
+        keep->setNext(nullptr);
+        mNext = start(keep);
+        mTotalAllocated = ALIGN(mPageSize + sizeof(LinearAllocator::Page));
+        mWastedSpace = mPageSize;
+        mPageCount = 1;
+    } else {
+        mNext = nullptr;
+        mTotalAllocated = 0;
+        mWastedSpace = 0;
+        mPageCount = 0;
+    }
 }
 
 void* LinearAllocator::start(Page* p) {
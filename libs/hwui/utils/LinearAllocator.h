@@ -105,6 +105,13 @@ public:
         rewindIfLastAlloc((void*)ptr, sizeof(T));
     }
 
+    /**
+     * Destroys everything allocated so far and rewinds to empty, like destroying and
+     * re-constructing the allocator, but keeps the current page (the largest one) to be
+     * reused by later allocations instead of freeing it.
+     */
+    void reset();
+
     /**
      * Dump memory usage statistics to the log (allocated and wasted space)
      */
@@ -131,6 +138,7 @@ private:
     void* allocImpl(size_t size);
 
     void addToDestructionList(Destructor, void* addr);
+    void runDestructors();
     void runDestructorFor(void* addr);
     Page* newPage(size_t pageSize);
     bool fitsInCurrentPage(size_t size);
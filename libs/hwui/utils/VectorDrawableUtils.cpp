@@ -67,6 +67,9 @@ void VectorDrawableUtils::verbsToPath(SkPath* outPath, const PathData& data) {
     char previousCommand = 'm';
     size_t start = 0;
     outPath->reset();
+    // Most verbs consume two floats per point, so this sizes the path's storage in one go
+    // instead of letting it grow verb by verb while the path is rebuilt.
+    outPath->incReserve(data.points.size() / 2);
     for (unsigned int i = 0; i < data.verbs.size(); i++) {
         size_t verbSize = data.verbSizes[i];
         resolver.addCommand(outPath, previousCommand, data.verbs[i], &data.points, start,
@@ -125,20 +125,15 @@ void MouseCursorController::setPosition(float x, float y) {
 void MouseCursorController::setPositionLocked(float x, float y) REQUIRES(mLock) {
     float minX, minY, maxX, maxY;
     if (getBoundsLocked(&minX, &minY, &maxX, &maxY)) {
-        if (x <= minX) {
-            mLocked.pointerX = minX;
-        } else if (x >= maxX) {
-            mLocked.pointerX = maxX;
-        } else {
-            mLocked.pointerX = x;
-        }
-        if (y <= minY) {
-            mLocked.pointerY = minY;
-        } else if (y >= maxY) {
-            mLocked.pointerY = maxY;
-        } else {
-            mLocked.pointerY = y;
+        const float pointerX = x <= minX ? minX : (x >= maxX ? maxX : x);
+        const float pointerY = y <= minY ? minY : (y >= maxY ? maxY : y);
+        // A cursor pushed against the edge of the display keeps reporting motion; there is
+        // nothing to send to the sprite when the clamped position does not move.
+        if (pointerX == mLocked.pointerX && pointerY == mLocked.pointerY) {
+            return;
         }
+        mLocked.pointerX = pointerX;
+        mLocked.pointerY = pointerY;
         updatePointerLocked();
     }
 }
@@ -359,6 +359,15 @@ void SpriteController::SpriteImpl::setIcon(const SpriteIcon& icon) {
 
     uint32_t dirty;
     if (icon.isValid()) {
+        // Setting the icon that is already shown would copy the bitmap and redraw the surface
+        // for nothing, so compare against the source of the current copy first.
+        if (mLocked.state.icon.isValid() && mLocked.iconSource.get() == icon.bitmap.get()
+                && mLocked.state.icon.hotSpotX == icon.hotSpotX
+                && mLocked.state.icon.hotSpotY == icon.hotSpotY
+                && mLocked.state.icon.style == icon.style) {
+            return;
+        }
+        mLocked.iconSource = icon.bitmap;
         mLocked.state.icon.bitmap = icon.bitmap.copy(ANDROID_BITMAP_FORMAT_RGBA_8888);
         if (!mLocked.state.icon.isValid()
                 || mLocked.state.icon.hotSpotX != icon.hotSpotX
@@ -376,6 +385,7 @@ void SpriteController::SpriteImpl::setIcon(const SpriteIcon& icon) {
         }
     } else if (mLocked.state.icon.isValid()) {
         mLocked.state.icon.bitmap.reset();
+        mLocked.iconSource.reset();
         dirty = DIRTY_BITMAP | DIRTY_HOTSPOT | DIRTY_ICON_STYLE;
     } else {
         return; // setting to invalid icon and already invalid so nothing to do
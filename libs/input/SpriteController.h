@@ -223,6 +223,8 @@ private:
 
         struct Locked {
             SpriteState state;
+            // The bitmap passed to the last setIcon() call, which state.icon holds a copy of.
+            graphics::Bitmap iconSource;
         } mLocked; // guarded by mController->mLock
 
         void invalidateLocked(uint32_t dirty);
@@ -60,6 +60,10 @@ private:
     size_t mMaxOffset;      // How much data is left to read in mBuffer.
     const int mChunkSize;   // Size of mBuffer.
     uint8_t mBuffer[32*1024];
+    off_t mStart;           // File offset the reader started at, or -1 if fd is not seekable.
+    uint8_t* mMap;          // Mapping of the rest of the file, or nullptr if reading into mBuffer.
+    size_t mMapLength;      // Length of mMap.
+    uint8_t const* mData;   // The data being read: mBuffer, or the reader's start offset in mMap.
 
     /**
      * If there is currently more data to read in the buffer, returns true.
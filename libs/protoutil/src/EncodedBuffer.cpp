@@ -143,7 +143,7 @@ EncodedBuffer::writeBuffer()
         buf = (uint8_t*)mmap(NULL, mChunkSize, PROT_READ | PROT_WRITE,
                 MAP_ANONYMOUS|MAP_PRIVATE, -1, 0);
 
-        if (buf == NULL) return NULL; // This indicates NO_MEMORY
+        if (buf == MAP_FAILED) return NULL; // This indicates NO_MEMORY
 
         mBuffers.push_back(buf);
     }
@@ -21,6 +21,7 @@
 #include <cinttypes>
 #include <type_traits>
 
+#include <sys/mman.h>
 #include <unistd.h>
 
 namespace android {
@@ -56,10 +57,34 @@ ProtoFileReader::ProtoFileReader(int fd)
          mPos(0),
          mOffset(0),
          mMaxOffset(0),
-         mChunkSize(sizeof(mBuffer)) {
+         mChunkSize(sizeof(mBuffer)),
+         mStart(lseek(fd, 0, SEEK_CUR)),
+         mMap(nullptr),
+         mMapLength(0),
+         mData(mBuffer) {
+    // Regular files, such as persisted incident reports, are mapped so the reader hands out the
+    // file contents directly instead of copying them through mBuffer one read() at a time.
+    if (mSize > 0 && mStart >= 0) {
+        const off_t pageSize = sysconf(_SC_PAGE_SIZE);
+        const off_t base = mStart - (mStart % pageSize);
+        const size_t length = (size_t)(mStart - base) + (size_t)mSize;
+        void* map = mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd, base);
+        if (map != MAP_FAILED) {
+            madvise(map, length, MADV_SEQUENTIAL);
+            mMap = static_cast<uint8_t*>(map);
+            mMapLength = length;
+            mData = mMap + (mStart - base);
+            mMaxOffset = (size_t)mSize;
+        }
+    }
 }
 
 ProtoFileReader::~ProtoFileReader() {
+    if (mMap != nullptr) {
+        munmap(mMap, mMapLength);
+        // Leave the file offset where a read()-based reader would have left it.
+        lseek(mFd, mStart + mPos, SEEK_SET);
+    }
 }
 
 ssize_t
@@ -77,7 +102,7 @@ ProtoFileReader::bytesRead() const
 uint8_t const*
 ProtoFileReader::readBuffer()
 {
-    return hasNext() ? mBuffer + mOffset : NULL;
+    return hasNext() ? mData + mOffset : NULL;
 }
 
 size_t
@@ -99,7 +124,8 @@ ProtoFileReader::next()
         // Shouldn't get to here.  Always call hasNext() before calling next().
         return 0;
     }
-    return mBuffer[mOffset++];
+    mPos++;
+    return mData[mOffset++];
 }
 
 uint64_t
@@ -130,6 +156,7 @@ ProtoFileReader::move(size_t amt)
         const size_t chunk =
                 mMaxOffset - mOffset > amt ? amt : mMaxOffset - mOffset;
         mOffset += chunk;
+        mPos += chunk;
         amt -= chunk;
     }
 }
@@ -147,6 +174,10 @@ ProtoFileReader::ensure_data() {
     if (mOffset < mMaxOffset) {
         return true;
     }
+    if (mMap != nullptr) {
+        // The whole rest of the file is already mapped.
+        return false;
+    }
     ssize_t amt = TEMP_FAILURE_RETRY(read(mFd, mBuffer, mChunkSize));
     if (amt == 0) {
         return false;
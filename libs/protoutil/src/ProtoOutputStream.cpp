@@ -18,6 +18,9 @@
 #include <cinttypes>
 #include <type_traits>
 
+#include <sys/uio.h>
+#include <unistd.h>
+
 #include <android-base/file.h>
 #include <android/util/protobuf.h>
 #include <android/util/ProtoOutputStream.h>
@@ -470,12 +473,34 @@ ProtoOutputStream::flush(int fd)
     if (fd < 0) return false;
     if (!compact()) return false;
 
+    // Hand the chunks to the kernel in batches instead of issuing one write per chunk.
+    const int kMaxIovecs = 16;
+    struct iovec iovs[kMaxIovecs];
     sp<ProtoReader> reader = mBuffer->read();
     while (reader->readBuffer() != NULL) {
-        if (!android::base::WriteFully(fd, reader->readBuffer(), reader->currentToRead())) {
-            return false;
+        int count = 0;
+        while (count < kMaxIovecs && reader->readBuffer() != NULL) {
+            iovs[count].iov_base = const_cast<uint8_t*>(reader->readBuffer());
+            iovs[count].iov_len = reader->currentToRead();
+            reader->move(iovs[count].iov_len);
+            count++;
+        }
+
+        struct iovec* iov = iovs;
+        while (count > 0) {
+            ssize_t written = TEMP_FAILURE_RETRY(writev(fd, iov, count));
+            if (written < 0) return false;
+            // Skip past whatever was written, which may end partway through an iovec.
+            while (count > 0 && (size_t)written >= iov->iov_len) {
+                written -= iov->iov_len;
+                iov++;
+                count--;
+            }
+            if (count > 0) {
+                iov->iov_base = static_cast<uint8_t*>(iov->iov_base) + written;
+                iov->iov_len -= written;
+            }
         }
-        reader->move(reader->currentToRead());
     }
     return true;
 }
@@ -564,14 +564,18 @@ static jobject CreateByteBuffer(
     jobject me = env->CallObjectMethod(
             byteBuffer, gByteBufferInfo.orderId, gByteBufferInfo.nativeByteOrder);
     env->DeleteLocalRef(me);
-    me = env->CallObjectMethod(
-            byteBuffer, gByteBufferInfo.limitId,
-            clearBuffer ? capacity : offset + size);
-    env->DeleteLocalRef(me);
-    me = env->CallObjectMethod(
-            byteBuffer, gByteBufferInfo.positionId,
-            clearBuffer ? 0 : offset);
-    env->DeleteLocalRef(me);
+    // A new direct buffer starts with position 0 and limit == capacity, so only call up
+    // into Java for the bounds that actually differ.
+    const size_t limit = clearBuffer ? capacity : offset + size;
+    if (limit != capacity) {
+        me = env->CallObjectMethod(byteBuffer, gByteBufferInfo.limitId, (jint)limit);
+        env->DeleteLocalRef(me);
+    }
+    const size_t position = clearBuffer ? 0 : offset;
+    if (position != 0) {
+        me = env->CallObjectMethod(byteBuffer, gByteBufferInfo.positionId, (jint)position);
+        env->DeleteLocalRef(me);
+    }
     me = NULL;
     return byteBuffer;
 }
@@ -463,7 +463,7 @@ jobjectArray FilterClientCallbackImpl::getSectionEvent(
     jmethodID eventInit = env->GetMethodID(eventClazz, "<init>", "(IIII)V");
 
     for (int i = 0; i < events.size(); i++) {
-        auto event = events[i];
+        const auto& event = events[i];
         DemuxFilterSectionEvent sectionEvent = event.section();
 
         jint tableId = static_cast<jint>(sectionEvent.tableId);
@@ -474,7 +474,9 @@ jobjectArray FilterClientCallbackImpl::getSectionEvent(
         jobject obj =
                 env->NewObject(eventClazz, eventInit, tableId, version, sectionNum, dataLength);
         env->SetObjectArrayElement(arr, i, obj);
+        env->DeleteLocalRef(obj);
     }
+    env->DeleteLocalRef(eventClazz);
     return arr;
 }
 
@@ -489,8 +491,8 @@ jobjectArray FilterClientCallbackImpl::getMediaEvent(
     jfieldID eventContext = env->GetFieldID(eventClazz, "mNativeContext", "J");
 
     for (int i = 0; i < events.size(); i++) {
-        auto event = events[i];
-        DemuxFilterMediaEvent mediaEvent = event.media();
+        const auto& event = events[i];
+        const DemuxFilterMediaEvent& mediaEvent = event.media();
 
         jobject audioDescriptor = NULL;
         if (mediaEvent.extraMetaData.getDiscriminator()
@@ -509,6 +511,7 @@ jobjectArray FilterClientCallbackImpl::getMediaEvent(
             audioDescriptor =
                     env->NewObject(adClazz, adInit, adFade, adPan, versionTextTag, adGainCenter,
                             adGainFront, adGainSurround);
+            env->DeleteLocalRef(adClazz);
         }
 
         jlong dataLength = static_cast<jlong>(mediaEvent.dataLength);
@@ -526,6 +529,9 @@ jobjectArray FilterClientCallbackImpl::getMediaEvent(
                 env->NewObject(eventClazz, eventInit, streamId, isPtsPresent, pts, dataLength,
                 offset, NULL, isSecureMemory, avDataId, mpuSequenceNumber, isPesPrivateData,
                 audioDescriptor);
+        if (audioDescriptor != NULL) {
+            env->DeleteLocalRef(audioDescriptor);
+        }
 
         if (mediaEvent.avMemory.getNativeHandle() != NULL || mediaEvent.avDataId != 0) {
             sp<MediaEvent> mediaEventSp =
@@ -537,7 +543,9 @@ jobjectArray FilterClientCallbackImpl::getMediaEvent(
         }
 
         env->SetObjectArrayElement(arr, i, obj);
+        env->DeleteLocalRef(obj);
     }
+    env->DeleteLocalRef(eventClazz);
     return arr;
 }
 
@@ -548,7 +556,7 @@ jobjectArray FilterClientCallbackImpl::getPesEvent(
     jmethodID eventInit = env->GetMethodID(eventClazz, "<init>", "(III)V");
 
     for (int i = 0; i < events.size(); i++) {
-        auto event = events[i];
+        const auto& event = events[i];
         DemuxFilterPesEvent pesEvent = event.pes();
 
         jint streamId = static_cast<jint>(pesEvent.streamId);
@@ -558,7 +566,9 @@ jobjectArray FilterClientCallbackImpl::getPesEvent(
         jobject obj =
                 env->NewObject(eventClazz, eventInit, streamId, dataLength, mpuSequenceNumber);
         env->SetObjectArrayElement(arr, i, obj);
+        env->DeleteLocalRef(obj);
     }
+    env->DeleteLocalRef(eventClazz);
     return arr;
 }
 
@@ -570,7 +580,7 @@ jobjectArray FilterClientCallbackImpl::getTsRecordEvent(
     jmethodID eventInit = env->GetMethodID(eventClazz, "<init>", "(IIIJJI)V");
 
     for (int i = 0; i < events.size(); i++) {
-        auto event = events[i];
+        const auto& event = events[i];
         DemuxFilterTsRecordEvent tsRecordEvent = event.tsRecord();
         DemuxPid pid = tsRecordEvent.pid;
 
@@ -611,7 +621,9 @@ jobjectArray FilterClientCallbackImpl::getTsRecordEvent(
                 env->NewObject(eventClazz, eventInit, jpid, ts, sc, byteNumber,
                         pts, firstMbInSlice);
         env->SetObjectArrayElement(arr, i, obj);
+        env->DeleteLocalRef(obj);
     }
+    env->DeleteLocalRef(eventClazz);
     return arr;
 }
 
@@ -623,7 +635,7 @@ jobjectArray FilterClientCallbackImpl::getMmtpRecordEvent(
     jmethodID eventInit = env->GetMethodID(eventClazz, "<init>", "(IJIJII)V");
 
     for (int i = 0; i < events.size(); i++) {
-        auto event = events[i];
+        const auto& event = events[i];
 
         DemuxFilterMmtpRecordEvent mmtpRecordEvent = event.mmtpRecord();
 
@@ -653,7 +665,9 @@ jobjectArray FilterClientCallbackImpl::getMmtpRecordEvent(
                 env->NewObject(eventClazz, eventInit, scHevcIndexMask, byteNumber,
                         mpuSequenceNumber, pts, firstMbInSlice, tsIndexMask);
         env->SetObjectArrayElement(arr, i, obj);
+        env->DeleteLocalRef(obj);
     }
+    env->DeleteLocalRef(eventClazz);
     return arr;
 }
 
@@ -664,7 +678,7 @@ jobjectArray FilterClientCallbackImpl::getDownloadEvent(
     jmethodID eventInit = env->GetMethodID(eventClazz, "<init>", "(IIIII)V");
 
     for (int i = 0; i < events.size(); i++) {
-        auto event = events[i];
+        const auto& event = events[i];
         DemuxFilterDownloadEvent downloadEvent = event.download();
 
         jint itemId = static_cast<jint>(downloadEvent.itemId);
@@ -677,7 +691,9 @@ jobjectArray FilterClientCallbackImpl::getDownloadEvent(
                 env->NewObject(eventClazz, eventInit, itemId, mpuSequenceNumber, itemFragmentIndex,
                         lastItemFragmentIndex, dataLength);
         env->SetObjectArrayElement(arr, i, obj);
+        env->DeleteLocalRef(obj);
     }
+    env->DeleteLocalRef(eventClazz);
     return arr;
 }
 
@@ -688,12 +704,14 @@ jobjectArray FilterClientCallbackImpl::getIpPayloadEvent(
     jmethodID eventInit = env->GetMethodID(eventClazz, "<init>", "(I)V");
 
     for (int i = 0; i < events.size(); i++) {
-        auto event = events[i];
+        const auto& event = events[i];
         DemuxFilterIpPayloadEvent ipPayloadEvent = event.ipPayload();
         jint dataLength = static_cast<jint>(ipPayloadEvent.dataLength);
         jobject obj = env->NewObject(eventClazz, eventInit, dataLength);
         env->SetObjectArrayElement(arr, i, obj);
+        env->DeleteLocalRef(obj);
     }
+    env->DeleteLocalRef(eventClazz);
     return arr;
 }
 
@@ -704,7 +722,7 @@ jobjectArray FilterClientCallbackImpl::getTemiEvent(
     jmethodID eventInit = env->GetMethodID(eventClazz, "<init>", "(JB[B)V");
 
     for (int i = 0; i < events.size(); i++) {
-        auto event = events[i];
+        const auto& event = events[i];
         DemuxFilterTemiEvent temiEvent = event.temi();
         jlong pts = static_cast<jlong>(temiEvent.pts);
         jbyte descrTag = static_cast<jbyte>(temiEvent.descrTag);
@@ -715,8 +733,11 @@ jobjectArray FilterClientCallbackImpl::getTemiEvent(
                 array, 0, descrData.size(), reinterpret_cast<jbyte*>(&descrData[0]));
 
         jobject obj = env->NewObject(eventClazz, eventInit, pts, descrTag, array);
+        env->DeleteLocalRef(array);
         env->SetObjectArrayElement(arr, i, obj);
+        env->DeleteLocalRef(obj);
     }
+    env->DeleteLocalRef(eventClazz);
     return arr;
 }
 
@@ -729,6 +750,8 @@ jobjectArray FilterClientCallbackImpl::getScramblingStatusEvent(
     auto scramblingStatus = eventsExt[0].monitorEvent().scramblingStatus();
     jobject obj = env->NewObject(eventClazz, eventInit, static_cast<jint>(scramblingStatus));
     env->SetObjectArrayElement(arr, 0, obj);
+    env->DeleteLocalRef(obj);
+    env->DeleteLocalRef(eventClazz);
     return arr;
 }
 
@@ -741,6 +764,8 @@ jobjectArray FilterClientCallbackImpl::getIpCidChangeEvent(
     auto cid = eventsExt[0].monitorEvent().cid();
     jobject obj = env->NewObject(eventClazz, eventInit, static_cast<jint>(cid));
     env->SetObjectArrayElement(arr, 0, obj);
+    env->DeleteLocalRef(obj);
+    env->DeleteLocalRef(eventClazz);
     return arr;
 }
 
@@ -753,6 +778,8 @@ jobjectArray FilterClientCallbackImpl::getRestartEvent(
     auto startId = eventsExt[0].startId();
     jobject obj = env->NewObject(eventClazz, eventInit, static_cast<jint>(startId));
     env->SetObjectArrayElement(arr, 0, obj);
+    env->DeleteLocalRef(obj);
+    env->DeleteLocalRef(eventClazz);
     return arr;
 }
 
@@ -761,16 +788,16 @@ void FilterClientCallbackImpl::onFilterEvent_1_1(const DemuxFilterEvent& filterE
     ALOGD("FilterClientCallbackImpl::onFilterEvent_1_1");
 
     JNIEnv *env = AndroidRuntime::getJNIEnv();
-    jobjectArray array;
+    jobjectArray array = NULL;
 
-    std::vector<DemuxFilterEvent::Event> events = filterEvent.events;
-    std::vector<DemuxFilterEventExt::Event> eventsExt = filterEventExt.events;
+    const std::vector<DemuxFilterEvent::Event>& events = filterEvent.events;
+    const std::vector<DemuxFilterEventExt::Event>& eventsExt = filterEventExt.events;
     jclass eventClazz = env->FindClass("android/media/tv/tuner/filter/FilterEvent");
 
     if (events.empty() && !eventsExt.empty()) {
         // Monitor event should be sent with one DemuxFilterMonitorEvent in DemuxFilterEventExt.
         array = env->NewObjectArray(1, eventClazz, NULL);
-        auto eventExt = eventsExt[0];
+        const auto& eventExt = eventsExt[0];
         switch (eventExt.getDiscriminator()) {
             case DemuxFilterEventExt::Event::hidl_discriminator::monitorEvent: {
                 switch (eventExt.monitorEvent().getDiscriminator()) {
@@ -800,7 +827,7 @@ void FilterClientCallbackImpl::onFilterEvent_1_1(const DemuxFilterEvent& filterE
 
     if (!events.empty()) {
         array = env->NewObjectArray(events.size(), eventClazz, NULL);
-        auto event = events[0];
+        const auto& event = events[0];
         switch (event.getDiscriminator()) {
             case DemuxFilterEvent::Event::hidl_discriminator::media: {
                 array = getMediaEvent(array, events);
@@ -849,6 +876,11 @@ void FilterClientCallbackImpl::onFilterEvent_1_1(const DemuxFilterEvent& filterE
         ALOGE("FilterClientCallbackImpl::onFilterEvent_1_1:"
                 "Filter object has been freed. Ignoring callback.");
     }
+    // This runs on a binder thread with no Java frame to pop, so local references are only
+    // reclaimed when deleted explicitly.
+    env->DeleteLocalRef(filter);
+    env->DeleteLocalRef(array);
+    env->DeleteLocalRef(eventClazz);
 }
 
 void FilterClientCallbackImpl::onFilterEvent(const DemuxFilterEvent& filterEvent) {
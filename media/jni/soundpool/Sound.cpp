@@ -20,15 +20,52 @@
 
 #include "Sound.h"
 
+#include <map>
+#include <mutex>
+#include <tuple>
+
 #include <media/NdkMediaCodec.h>
 #include <media/NdkMediaExtractor.h>
 #include <media/NdkMediaFormat.h>
+#include <sys/stat.h>
 
 namespace android::soundpool {
 
 constexpr uint32_t kMaxSampleRate = 192000;
 constexpr size_t   kDefaultHeapSize = 1024 * 1024; // 1MB (compatible with low mem devices)
 
+namespace {
+
+// Games and keyboards often load the same file into several SoundPools, so decoded
+// samples are shared process-wide. Entries hold the heap weakly: the PCM is freed
+// once the last Sound using it goes away.
+struct DecodedSound {
+    wp<MemoryHeapBase>   heap;
+    size_t               sizeInBytes;
+    uint32_t             sampleRate;
+    int32_t              channelCount;
+    audio_format_t       format;
+    audio_channel_mask_t channelMask;
+};
+
+// (device, inode, mtime, offset, length) of the source data.
+using DecodedSoundKey = std::tuple<dev_t, ino_t, int64_t, int64_t, int64_t>;
+
+std::mutex gDecodedSoundsLock;
+std::map<DecodedSoundKey, DecodedSound> gDecodedSounds; // GUARDED_BY(gDecodedSoundsLock)
+
+bool getDecodedSoundKey(int fd, int64_t offset, int64_t length, DecodedSoundKey* key) {
+    struct stat st;
+    if (fstat(fd, &st) != 0 || !S_ISREG(st.st_mode)) {
+        return false;
+    }
+    const int64_t mtimeNs = st.st_mtim.tv_sec * 1000000000LL + st.st_mtim.tv_nsec;
+    *key = {st.st_dev, st.st_ino, mtimeNs, offset, length};
+    return true;
+}
+
+} // namespace
+
 Sound::Sound(int32_t soundID, int fd, int64_t offset, int64_t length)
     : mSoundID(soundID)
     , mFd(fcntl(fd, F_DUPFD_CLOEXEC, (int)0 /* arg */)) // dup(fd) + close on exec to prevent leaks.
@@ -197,6 +234,29 @@ status_t Sound::doLoad()
     ALOGV("%s()", __func__);
     status_t status = NO_INIT;
     if (mFd.get() != -1) {
+        DecodedSoundKey key;
+        const bool cacheable = getDecodedSoundKey(mFd.get(), mOffset, mLength, &key);
+        if (cacheable) {
+            std::lock_guard lock(gDecodedSoundsLock);
+            auto it = gDecodedSounds.find(key);
+            if (it != gDecodedSounds.end()) {
+                if (sp<MemoryHeapBase> heap = it->second.heap.promote()) {
+                    ALOGV("%s: reusing decoded data %p", __func__, heap->getBase());
+                    mFd.reset();  // close
+                    mHeap = heap;
+                    mSizeInBytes = it->second.sizeInBytes;
+                    mData = new MemoryBase(mHeap, 0, mSizeInBytes);
+                    mSampleRate = it->second.sampleRate;
+                    mChannelCount = it->second.channelCount;
+                    mFormat = it->second.format;
+                    mChannelMask = it->second.channelMask;
+                    mState = READY;  // this should be last, as it is an atomic sync point
+                    return NO_ERROR;
+                }
+                gDecodedSounds.erase(it);
+            }
+        }
+
         mHeap = new MemoryHeapBase(kDefaultHeapSize);
 
         ALOGV("%s: start decode", __func__);
@@ -226,6 +286,15 @@ status_t Sound::doLoad()
             mChannelCount = channelCount;
             mFormat = format;
             mChannelMask = channelMask;
+            if (cacheable) {
+                std::lock_guard lock(gDecodedSoundsLock);
+                // Drop entries whose sounds have all been unloaded before adding this one.
+                for (auto it = gDecodedSounds.begin(); it != gDecodedSounds.end();) {
+                    it = it->second.heap.promote() == nullptr ? gDecodedSounds.erase(it) : ++it;
+                }
+                gDecodedSounds[key] = {mHeap, mSizeInBytes, sampleRate, channelCount, format,
+                                       channelMask};
+            }
             mState = READY;  // this should be last, as it is an atomic sync point
             return NO_ERROR;
         }
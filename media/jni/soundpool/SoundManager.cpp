@@ -20,13 +20,18 @@
 
 #include "SoundManager.h"
 
+#include <algorithm>
 #include <thread>
 
 #include "SoundDecoder.h"
 
 namespace android::soundpool {
 
-static const size_t kDecoderThreads = std::thread::hardware_concurrency() >= 4 ? 2 : 1;
+// Decoding is CPU bound, so a large batch of loads scales with the cores we have.
+// Keep half of them for the app itself, and cap the number of codec instances in flight.
+static constexpr size_t kMaxDecoderThreads = 4;
+static const size_t kDecoderThreads =
+        std::clamp((size_t)std::thread::hardware_concurrency() / 2, (size_t)1, kMaxDecoderThreads);
 
 SoundManager::SoundManager()
     : mDecoder{std::make_unique<SoundDecoder>(this, kDecoderThreads)}
@@ -18,6 +18,7 @@
 
 #include <android-base/logging.h>
 #include <fmq/ConvertMQDescriptors.h>
+#include <sys/uio.h>
 #include <utils/Log.h>
 
 #include "ClientHelper.h"
@@ -28,6 +29,22 @@ using ::android::hardware::tv::tuner::V1_0::Result;
 
 namespace android {
 
+// Describes the first |size| bytes of an FMQ transaction, which may wrap around the end of
+// the ring into a second region. Returns the number of iovecs filled in.
+static int getTransactionIovecs(const AidlMQ::MemTransaction& tx, long size, struct iovec* iov) {
+    const auto& first = tx.getFirstRegion();
+    const long firstLength = std::min(static_cast<long>(first.getLength()), size);
+    iov[0].iov_base = first.getAddress();
+    iov[0].iov_len = firstLength;
+    if (firstLength == size) {
+        return 1;
+    }
+    const auto& second = tx.getSecondRegion();
+    iov[1].iov_base = second.getAddress();
+    iov[1].iov_len = std::min(static_cast<long>(second.getLength()), size - firstLength);
+    return 2;
+}
+
 /////////////// DvrClient ///////////////////////
 
 DvrClient::DvrClient(shared_ptr<ITunerDvr> tunerDvr) {
@@ -70,26 +87,17 @@ long DvrClient::readFromFile(long size) {
     AidlMQ::MemTransaction tx;
     long ret = 0;
     if (mDvrMQ->beginWrite(write, &tx)) {
-        auto first = tx.getFirstRegion();
-        auto data = first.getAddress();
-        long length = first.getLength();
-        long firstToWrite = min(length, write);
-        ret = read(mFd, data, firstToWrite);
+        // Fill both regions of the ring with a single syscall.
+        struct iovec iov[2];
+        const int iovcnt = getTransactionIovecs(tx, write, iov);
+        ret = readv(mFd, iov, iovcnt);
 
         if (ret < 0) {
             ALOGE("Failed to read from FD: %s", strerror(errno));
             return -1;
         }
-        if (ret < firstToWrite) {
-            ALOGW("file to MQ, first region: %ld bytes to write, but %ld bytes written",
-                    firstToWrite, ret);
-        } else if (firstToWrite < write) {
-            ALOGD("write second region: %ld bytes written, %ld bytes in total", ret, write);
-            auto second = tx.getSecondRegion();
-            data = second.getAddress();
-            length = second.getLength();
-            int secondToWrite = std::min(length, write - firstToWrite);
-            ret += read(mFd, data, secondToWrite);
+        if (ret < write) {
+            ALOGW("file to MQ: %ld bytes to write, but %ld bytes written", write, ret);
         }
         ALOGD("file to MQ: %ld bytes need to be written, %ld bytes written", write, ret);
         if (!mDvrMQ->commitWrite(ret)) {
@@ -144,25 +152,17 @@ long DvrClient::writeToFile(long size) {
     long ret = 0;
     AidlMQ::MemTransaction tx;
     if (mDvrMQ->beginRead(toRead, &tx)) {
-        auto first = tx.getFirstRegion();
-        auto data = first.getAddress();
-        long length = first.getLength();
-        long firstToRead = std::min(length, toRead);
-        ret = write(mFd, data, firstToRead);
+        // Drain both regions of the ring with a single syscall.
+        struct iovec iov[2];
+        const int iovcnt = getTransactionIovecs(tx, toRead, iov);
+        ret = writev(mFd, iov, iovcnt);
 
         if (ret < 0) {
             ALOGE("Failed to write to FD: %s", strerror(errno));
             return -1;
         }
-        if (ret < firstToRead) {
-            ALOGW("MQ to file: %ld bytes read, but %ld bytes written", firstToRead, ret);
-        } else if (firstToRead < toRead) {
-            ALOGD("read second region: %ld bytes read, %ld bytes in total", ret, toRead);
-            auto second = tx.getSecondRegion();
-            data = second.getAddress();
-            length = second.getLength();
-            int secondToRead = toRead - firstToRead;
-            ret += write(mFd, data, secondToRead);
+        if (ret < toRead) {
+            ALOGW("MQ to file: %ld bytes read, but %ld bytes written", toRead, ret);
         }
         ALOGD("MQ to file: %ld bytes to be read, %ld bytes written", toRead, ret);
         if (!mDvrMQ->commitRead(ret)) {
@@ -48,6 +48,7 @@ GLFrame::GLFrame(GLEnv* gl_env)
     texture_target_(GL_TEXTURE_2D),
     texture_state_(kStateUninitialized),
     fbo_state_(kStateUninitialized),
+    has_texture_storage_(false),
     owns_texture_(false),
     owns_fbo_(false) {
   SetDefaultTexParameters();
@@ -89,6 +90,7 @@ void GLFrame::InitDimensions(int width, int height) {
   height_ = height;
   vp_width_ = width;
   vp_height_ = height;
+  has_texture_storage_ = false;
 }
 
 GLFrame::~GLFrame() {
@@ -316,6 +318,7 @@ bool GLFrame::AllocateTexture() {
     if (!GLEnv::CheckGLError("Texture Allocation")) {
       UpdateTexParameters();
       texture_state_ = kStateComplete;
+      has_texture_storage_ = true;
     }
   }
   return texture_state_ == kStateComplete;
@@ -446,12 +449,24 @@ bool GLFrame::DetachTextureFromFbo() {
 }
 
 bool GLFrame::UploadTexturePixels(const uint8_t* pixels) {
+  // Once we have specified storage of our size and format, write into it
+  // rather than making the driver reallocate it (and revalidate any FBO it is
+  // attached to) on every upload. Textures passed to InitWithTexture may have
+  // any storage, so they get respecified on their first upload. Check before
+  // binding, as binding a deleted name brings it back without storage.
+  const bool has_storage = has_texture_storage_ && !TextureWasDeleted();
+
   // Bind the texture object
   FocusTexture();
 
   // Load mipmap level 0
-  glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, width_, height_,
-               0, GL_RGBA, GL_UNSIGNED_BYTE, pixels);
+  if (has_storage) {
+    glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, width_, height_,
+                    GL_RGBA, GL_UNSIGNED_BYTE, pixels);
+  } else {
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, width_, height_,
+                 0, GL_RGBA, GL_UNSIGNED_BYTE, pixels);
+  }
 
   // Set the user specified texture parameters
   UpdateTexParameters();
@@ -460,6 +475,7 @@ bool GLFrame::UploadTexturePixels(const uint8_t* pixels) {
     return false;
 
   texture_state_ = kStateComplete;
+  has_texture_storage_ = true;
   return true;
 }
 
@@ -203,6 +203,10 @@ class GLFrame : public GLBufferHandle {
     GLObjectState texture_state_;
     GLObjectState fbo_state_;
 
+    // Flags whether we have specified width_ x height_ RGBA storage for the
+    // texture, so that uploads can update it in place
+    bool has_texture_storage_;
+
     // Set of current texture parameters
     std::map<GLenum, GLint> tex_params_;
 
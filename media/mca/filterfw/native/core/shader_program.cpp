@@ -78,6 +78,8 @@ ShaderProgram::ShaderProgram(GLEnv* gl_env, const std::string& fragment_shader)
     source_coords_(NULL),
     target_coords_(NULL),
     manage_coordinates_(false),
+    tex_coord_attr_(-1),
+    pos_coord_attr_(-1),
     tile_x_count_(1),
     tile_y_count_(1),
     vertex_count_(4),
@@ -102,6 +104,8 @@ ShaderProgram::ShaderProgram(GLEnv* gl_env,
     source_coords_(NULL),
     target_coords_(NULL),
     manage_coordinates_(false),
+    tex_coord_attr_(-1),
+    pos_coord_attr_(-1),
     tile_x_count_(1),
     tile_y_count_(1),
     vertex_count_(4),
@@ -282,9 +286,9 @@ bool ShaderProgram::CompileAndLink() {
 
   // Check if we manage all coordinates
   if (program_ != 0) {
-    ProgramVar tex_coord_attr = glGetAttribLocation(program_, TexCoordAttributeName().c_str());
-    ProgramVar pos_coord_attr = glGetAttribLocation(program_, PositionAttributeName().c_str());
-    manage_coordinates_ = (tex_coord_attr >= 0 && pos_coord_attr >= 0);
+    tex_coord_attr_ = glGetAttribLocation(program_, TexCoordAttributeName().c_str());
+    pos_coord_attr_ = glGetAttribLocation(program_, PositionAttributeName().c_str());
+    manage_coordinates_ = (tex_coord_attr_ >= 0 && pos_coord_attr_ >= 0);
   } else {
     ALOGE("Could not link shader program!");
     return false;
@@ -401,13 +405,11 @@ bool ShaderProgram::PushCoords(ProgramVar attr, float* coords) {
 }
 
 bool ShaderProgram::PushSourceCoords(float* coords) {
-  ProgramVar tex_coord_attr = glGetAttribLocation(program_, TexCoordAttributeName().c_str());
-  return PushCoords(tex_coord_attr, coords);
+  return PushCoords(tex_coord_attr_, coords);
 }
 
 bool ShaderProgram::PushTargetCoords(float* coords) {
-  ProgramVar pos_coord_attr = glGetAttribLocation(program_, PositionAttributeName().c_str());
-  return PushCoords(pos_coord_attr, coords);
+  return PushCoords(pos_coord_attr_, coords);
 }
 
 std::string ShaderProgram::InputTextureUniformName(int index) {
@@ -418,6 +420,12 @@ std::string ShaderProgram::InputTextureUniformName(int index) {
 
 bool ShaderProgram::BindInputTextures(const std::vector<GLuint>& textures,
                                       const std::vector<GLenum>& targets) {
+  // Look up the sampler uniforms once, rather than formatting their names and
+  // querying GL for them on every frame.
+  while (tex_sampler_vars_.size() < textures.size()) {
+    tex_sampler_vars_.push_back(GetUniform(InputTextureUniformName(tex_sampler_vars_.size())));
+  }
+
   for (unsigned i = 0; i < textures.size(); ++i) {
     // Activate texture unit i
     glActiveTexture(BaseTextureUnit() + i);
@@ -431,7 +439,7 @@ bool ShaderProgram::BindInputTextures(const std::vector<GLuint>& textures,
       return false;
 
     // Set the texture handle in the shader to unit i
-    ProgramVar tex_var = GetUniform(InputTextureUniformName(i));
+    ProgramVar tex_var = tex_sampler_vars_[i];
     if (tex_var >= 0) {
       glUniform1i(tex_var, i);
     } else {
@@ -519,6 +519,14 @@ class ShaderProgram {
     // True, if the program has control over both source and target coordinates.
     bool manage_coordinates_;
 
+    // The locations of the coordinate attributes, or -1 if the shader does not
+    // define them.
+    ProgramVar tex_coord_attr_;
+    ProgramVar pos_coord_attr_;
+
+    // The locations of the tex_sampler_<i> uniforms, indexed by input.
+    std::vector<ProgramVar> tex_sampler_vars_;
+
     // The number of tiles to split rendering into.
     int tile_x_count_;
     int tile_y_count_;
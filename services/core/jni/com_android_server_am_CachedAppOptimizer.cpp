@@ -41,6 +41,7 @@
 #include <unistd.h>
 
 #include <algorithm>
+#include <atomic>
 
 using android::base::StringPrintf;
 using android::base::WriteStringToFile;
@@ -72,8 +73,10 @@ using android::base::unique_fd;
 
 namespace android {
 
-static bool cancelRunningCompaction;
-static bool compactionInProgress;
+// Set from the cancelCompaction binder thread while the compaction thread is running, so
+// both are atomic. A cancel stops the whole compactProcess(), not just its current pass.
+static std::atomic<bool> cancelRunningCompaction;
+static std::atomic<bool> compactionInProgress;
 
 // Legacy method for compacting processes, any new code should
 // use compactProcess instead.
@@ -90,7 +93,7 @@ static inline void compactProcessProcfs(int pid, const std::string& compactionTy
 static int64_t compactMemory(const std::vector<Vma>& vmas, int pid, int madviseType) {
     // UIO_MAXIOV is currently a small value and we might have more addresses
     // we do multiple syscalls if we exceed its maximum
-    static struct iovec vmasToKernel[UIO_MAXIOV];
+    static struct iovec vmasToKernel[MAX_VMAS_PER_COMPACTION];
 
     if (vmas.empty()) {
         return 0;
@@ -101,34 +104,47 @@ static int64_t compactMemory(const std::vector<Vma>& vmas, int pid, int madviseT
         // Skip compaction if failed to open pidfd with any error
         return -errno;
     }
-    compactionInProgress = true;
-    cancelRunningCompaction = false;
 
     int64_t totalBytesCompacted = 0;
-    for (int iBase = 0; iBase < vmas.size(); iBase += UIO_MAXIOV) {
-        if (CC_UNLIKELY(cancelRunningCompaction)) {
+    size_t iVma = 0;
+    // Bytes of vmas[iVma] already sent. The kernel truncates an iovec array past
+    // MAX_RW_COUNT bytes, so large VMAs are split across syscalls.
+    uint64_t vmaOffset = 0;
+    while (iVma < vmas.size()) {
+        if (CC_UNLIKELY(cancelRunningCompaction.load())) {
             // There could be a significant delay betweenwhen a compaction
             // is requested and when it is handled during this time
             // our OOM adjust could have improved.
-            cancelRunningCompaction = false;
             break;
         }
-        int totalVmasToKernel = std::min(UIO_MAXIOV, (int)(vmas.size() - iBase));
-        for (int iVec = 0, iVma = iBase; iVec < totalVmasToKernel; ++iVec, ++iVma) {
-            vmasToKernel[iVec].iov_base = (void*)vmas[iVma].start;
-            vmasToKernel[iVec].iov_len = vmas[iVma].end - vmas[iVma].start;
+        int totalVmasToKernel = 0;
+        uint64_t bytesToKernel = 0;
+        while (iVma < vmas.size() && totalVmasToKernel < MAX_VMAS_PER_COMPACTION &&
+               bytesToKernel < MAX_BYTES_PER_COMPACTION) {
+            const uint64_t vmaStart = vmas[iVma].start + vmaOffset;
+            const uint64_t vmaSize = vmas[iVma].end - vmaStart;
+            const uint64_t bytes = std::min<uint64_t>(vmaSize,
+                                                      MAX_BYTES_PER_COMPACTION - bytesToKernel);
+            vmasToKernel[totalVmasToKernel].iov_base = (void*)vmaStart;
+            vmasToKernel[totalVmasToKernel].iov_len = bytes;
+            ++totalVmasToKernel;
+            bytesToKernel += bytes;
+            if (bytes == vmaSize) {
+                ++iVma;
+                vmaOffset = 0;
+            } else {
+                vmaOffset += bytes;
+            }
         }
 
         auto bytesCompacted =
                 process_madvise(pidfd, vmasToKernel, totalVmasToKernel, madviseType, 0);
         if (CC_UNLIKELY(bytesCompacted == -1)) {
-            compactionInProgress = false;
             return -errno;
         }
 
         totalBytesCompacted += bytesCompacted;
     }
-    compactionInProgress = false;
 
     return totalBytesCompacted;
 }
@@ -175,13 +191,19 @@ static int64_t compactProcess(int pid, VmaToAdviseFunc vmaToAdviseFunc) {
     };
     meminfo.ForEachVmaFromMaps(vmaCollectorCb);
 
+    compactionInProgress = true;
+    cancelRunningCompaction = false;
+
     int64_t pageoutBytes = compactMemory(pageoutVmas, pid, MADV_PAGEOUT);
     if (pageoutBytes < 0) {
         // Error, just forward it.
+        compactionInProgress = false;
         return pageoutBytes;
     }
 
     int64_t coldBytes = compactMemory(coldVmas, pid, MADV_COLD);
+    compactionInProgress = false;
+    cancelRunningCompaction = false;
     if (coldBytes < 0) {
         // Error, just forward it.
         return coldBytes;
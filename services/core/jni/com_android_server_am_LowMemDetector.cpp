@@ -110,9 +110,13 @@ static jint android_server_am_LowMemDetector_waitForPressure(JNIEnv*, jobject) {
             // the memory pressure state can go up due to a different FD
             // becoming available or it can go down when that window expires.
             // Accordingly, there's no polling: just epoll_wait with a 1s timeout.
-            nevents = epoll_wait(psi_epollfd, events, PRESSURE_LEVEL_COUNT, 1000);
+            // Pressure decays one level per quiet window rather than dropping
+            // straight to none, so a stall that briefly dips below the high
+            // threshold doesn't flap callers between HIGH and NONE.
+            nevents = epoll_wait(psi_epollfd, events, PRESSURE_LEVEL_COUNT,
+                                 PSI_WINDOW_SIZE_US / 1000);
             if (nevents == 0) {
-                pressure_level = PRESSURE_NONE;
+                pressure_level--;
                 return pressure_level;
             }
         }
@@ -124,8 +128,11 @@ static jint android_server_am_LowMemDetector_waitForPressure(JNIEnv*, jobject) {
         return -1;
     }
 
-    // reset pressure_level and raise it based on received events
-    pressure_level = PRESSURE_NONE;
+    // lower pressure_level by at most one step and raise it based on
+    // received events
+    if (pressure_level > PRESSURE_NONE) {
+        pressure_level--;
+    }
     for (int i = 0; i < nevents; i++) {
         if (events[i].events & (EPOLLERR | EPOLLHUP)) {
             // should never happen unless psi got disabled in kernel
@@ -25,9 +25,16 @@
 #include <nativehelper/ScopedPrimitiveArray.h>
 #include <powermanager/PowerHalController.h>
 #include <utils/Log.h>
+#include <utils/Timers.h>
 
 #include <unistd.h>
+#include <algorithm>
+#include <chrono>
 #include <cinttypes>
+#include <condition_variable>
+#include <mutex>
+#include <set>
+#include <thread>
 
 #include <sys/types.h>
 
@@ -42,43 +49,161 @@ namespace android {
 
 static power::PowerHalController gPowerHalController;
 
+// Rate, in nanoseconds, at which the HAL wants actual work durations; 0 or less
+// means every report is forwarded as it arrives. Read once in nativeInit.
+static int64_t gPreferredRateNanos = -1;
+
+// Native peer of a Java hint session. Apps report on every frame, so actual
+// work durations are coalesced here and forwarded to the HAL about once per
+// preferred rate interval instead of one binder call per report.
+struct HintSession {
+    explicit HintSession(sp<IPowerHintSession> session) : session(std::move(session)) {}
+
+    const sp<IPowerHintSession> session;
+
+    std::mutex lock;
+    std::vector<WorkDuration> pendingDurations; // guarded by lock
+    nsecs_t lastFlushNanos = 0;                 // guarded by lock
+    nsecs_t firstPendingNanos = 0;              // guarded by lock
+};
+
+// Sessions with pending durations, flushed by the deadline thread once their
+// oldest pending report has waited a full preferred rate interval. This bounds
+// how long a report is held when the app stops reporting without pausing.
+static std::mutex gDeadlineLock;
+static std::condition_variable gDeadlineCondition;
+static std::set<HintSession*> gPendingSessions; // guarded by gDeadlineLock
+
+static HintSession* toHintSession(int64_t session_ptr) {
+    return reinterpret_cast<HintSession*>(session_ptr);
+}
+
+// Sends any coalesced durations to the HAL. Called before operations that
+// change how the HAL interprets them, so no report is applied to the wrong
+// target or lost on close.
+static void flushActualWorkDurations(HintSession* hintSession) {
+    std::vector<WorkDuration> durations;
+    {
+        std::lock_guard<std::mutex> guard(hintSession->lock);
+        durations.swap(hintSession->pendingDurations);
+        hintSession->lastFlushNanos = systemTime(SYSTEM_TIME_MONOTONIC);
+    }
+    if (!durations.empty()) {
+        hintSession->session->reportActualWorkDuration(durations);
+    }
+}
+
+static void flushExpiredSessionsLoop() {
+    std::unique_lock<std::mutex> deadlineGuard(gDeadlineLock);
+    while (true) {
+        if (gPendingSessions.empty()) {
+            gDeadlineCondition.wait(deadlineGuard);
+            continue;
+        }
+
+        const nsecs_t now = systemTime(SYSTEM_TIME_MONOTONIC);
+        nsecs_t nextDeadline = now + gPreferredRateNanos;
+        for (auto it = gPendingSessions.begin(); it != gPendingSessions.end();) {
+            HintSession* hintSession = *it;
+            nsecs_t deadline;
+            {
+                std::lock_guard<std::mutex> guard(hintSession->lock);
+                deadline = hintSession->pendingDurations.empty()
+                        ? now
+                        : hintSession->firstPendingNanos + gPreferredRateNanos;
+            }
+            if (deadline > now) {
+                nextDeadline = std::min(nextDeadline, deadline);
+                ++it;
+                continue;
+            }
+            // gDeadlineLock stays held so that closeHintSession cannot delete the
+            // session while it is being flushed.
+            flushActualWorkDurations(hintSession);
+            it = gPendingSessions.erase(it);
+        }
+        gDeadlineCondition.wait_for(deadlineGuard, std::chrono::nanoseconds(nextDeadline - now));
+    }
+}
+
 static jlong createHintSession(JNIEnv* env, int32_t tgid, int32_t uid,
                                std::vector<int32_t> threadIds, int64_t durationNanos) {
     auto result =
             gPowerHalController.createHintSession(tgid, uid, std::move(threadIds), durationNanos);
-    if (result.isOk()) {
-        sp<IPowerHintSession> appSession = result.value();
-        if (appSession) appSession->incStrong(env);
-        return reinterpret_cast<jlong>(appSession.get());
+    if (result.isOk() && result.value() != nullptr) {
+        return reinterpret_cast<jlong>(new HintSession(result.value()));
     }
     return 0;
 }
 
 static void pauseHintSession(JNIEnv* env, int64_t session_ptr) {
-    sp<IPowerHintSession> appSession = reinterpret_cast<IPowerHintSession*>(session_ptr);
-    appSession->pause();
+    HintSession* hintSession = toHintSession(session_ptr);
+    flushActualWorkDurations(hintSession);
+    hintSession->session->pause();
 }
 
 static void resumeHintSession(JNIEnv* env, int64_t session_ptr) {
-    sp<IPowerHintSession> appSession = reinterpret_cast<IPowerHintSession*>(session_ptr);
-    appSession->resume();
+    toHintSession(session_ptr)->session->resume();
 }
 
 static void closeHintSession(JNIEnv* env, int64_t session_ptr) {
-    sp<IPowerHintSession> appSession = reinterpret_cast<IPowerHintSession*>(session_ptr);
-    appSession->close();
-    appSession->decStrong(env);
+    HintSession* hintSession = toHintSession(session_ptr);
+    {
+        std::lock_guard<std::mutex> deadlineGuard(gDeadlineLock);
+        gPendingSessions.erase(hintSession);
+    }
+    flushActualWorkDurations(hintSession);
+    hintSession->session->close();
+    delete hintSession;
 }
 
 static void updateTargetWorkDuration(int64_t session_ptr, int64_t targetDurationNanos) {
-    sp<IPowerHintSession> appSession = reinterpret_cast<IPowerHintSession*>(session_ptr);
-    appSession->updateTargetWorkDuration(targetDurationNanos);
+    HintSession* hintSession = toHintSession(session_ptr);
+    flushActualWorkDurations(hintSession);
+    hintSession->session->updateTargetWorkDuration(targetDurationNanos);
 }
 
 static void reportActualWorkDuration(int64_t session_ptr,
                                      const std::vector<WorkDuration>& actualDurations) {
-    sp<IPowerHintSession> appSession = reinterpret_cast<IPowerHintSession*>(session_ptr);
-    appSession->reportActualWorkDuration(actualDurations);
+    HintSession* hintSession = toHintSession(session_ptr);
+    std::vector<WorkDuration> durations;
+    bool startedPending = false;
+    {
+        std::lock_guard<std::mutex> guard(hintSession->lock);
+        std::vector<WorkDuration>& pending = hintSession->pendingDurations;
+        const bool wasEmpty = pending.empty();
+        for (const WorkDuration& duration : actualDurations) {
+            // Drop reports that were already queued, e.g. a frame re-reported by a retry.
+            if (!pending.empty() && pending.back().timeStampNanos == duration.timeStampNanos &&
+                pending.back().durationNanos == duration.durationNanos) {
+                continue;
+            }
+            pending.push_back(duration);
+        }
+
+        const nsecs_t now = systemTime(SYSTEM_TIME_MONOTONIC);
+        // Flush once half the interval has passed rather than the full one, so
+        // reports arriving at about the preferred rate are not held back a whole
+        // extra interval by scheduling jitter.
+        if (!pending.empty() &&
+            (gPreferredRateNanos <= 0 ||
+             now - hintSession->lastFlushNanos >= gPreferredRateNanos / 2)) {
+            durations.swap(pending);
+            hintSession->lastFlushNanos = now;
+        } else if (wasEmpty && !pending.empty()) {
+            hintSession->firstPendingNanos = now;
+            startedPending = true;
+        }
+    }
+    if (startedPending) {
+        std::lock_guard<std::mutex> deadlineGuard(gDeadlineLock);
+        if (gPendingSessions.insert(hintSession).second && gPendingSessions.size() == 1) {
+            gDeadlineCondition.notify_one();
+        }
+    }
+    if (!durations.empty()) {
+        hintSession->session->reportActualWorkDuration(durations);
+    }
 }
 
 static int64_t getHintSessionPreferredRate() {
@@ -93,6 +218,10 @@ static int64_t getHintSessionPreferredRate() {
 // ----------------------------------------------------------------------------
 static void nativeInit(JNIEnv* env, jobject obj) {
     gPowerHalController.init();
+    gPreferredRateNanos = getHintSessionPreferredRate();
+    if (gPreferredRateNanos > 0) {
+        std::thread(flushExpiredSessionsLoop).detach();
+    }
 }
 
 static jlong nativeCreateHintSession(JNIEnv* env, jclass /* clazz */, jint tgid, jint uid,
@@ -18,8 +18,10 @@
 
 #include <errno.h>
 #include <inttypes.h>
+#include <string.h>
 #include <sys/stat.h>
 #include <sys/types.h>
+#include <utility>
 #include <vector>
 
 #include <jni.h>
@@ -248,9 +250,23 @@ static int statsLinesToNetworkStats(JNIEnv* env, jclass clazz, jobject stats,
             gNetworkStatsClassInfo.operations, size, grow));
     if (operations.get() == NULL) return -1;
 
+    // Thousands of lines share a handful of interface names, so create one String per
+    // distinct name rather than one per line.
+    std::vector<std::pair<const char*, jstring>> ifaceStrings;
     for (int i = 0; i < size; i++) {
-        ScopedLocalRef<jstring> ifaceString(env, env->NewStringUTF(lines[i].iface));
-        env->SetObjectArrayElement(iface.get(), i, ifaceString.get());
+        jstring ifaceString = nullptr;
+        for (const auto& [name, string] : ifaceStrings) {
+            if (strcmp(name, lines[i].iface) == 0) {
+                ifaceString = string;
+                break;
+            }
+        }
+        if (ifaceString == nullptr) {
+            ifaceString = env->NewStringUTF(lines[i].iface);
+            if (ifaceString == nullptr) return -1;
+            ifaceStrings.emplace_back(lines[i].iface, ifaceString);
+        }
+        env->SetObjectArrayElement(iface.get(), i, ifaceString);
 
         uid[i] = lines[i].uid;
         set[i] = lines[i].set;
@@ -261,6 +277,9 @@ static int statsLinesToNetworkStats(JNIEnv* env, jclass clazz, jobject stats,
         txBytes[i] = lines[i].txBytes;
         txPackets[i] = lines[i].txPackets;
     }
+    for (const auto& [name, string] : ifaceStrings) {
+        env->DeleteLocalRef(string);
+    }
 
     env->SetIntField(stats, gNetworkStatsClassInfo.size, size);
     if (grow) {
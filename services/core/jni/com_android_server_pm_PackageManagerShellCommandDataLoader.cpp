@@ -29,8 +29,12 @@
 #include <sys/eventfd.h>
 #include <sys/poll.h>
 
+#include <array>
 #include <charconv>
 #include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
 #include <span>
 #include <string>
 #include <thread>
@@ -789,10 +793,49 @@ private:
         ATRACE_END();
     }
 
-    void receiver(unique_fd inout, MetadataMode mode) {
+    // A chunk read from the adb stream, together with the incfs writes parsed out of it.
+    struct ReceivedChunk {
         std::vector<uint8_t> data;
         std::vector<IncFsDataBlock> instructions;
+    };
+
+    void receiver(unique_fd inout, MetadataMode mode) {
         std::unordered_map<FileIdx, unique_fd> writeFds;
+
+        // Blocks are written to incfs on a separate thread, so reading and parsing the next chunk
+        // overlaps with writing the previous one. The chunk buffers are reused, and the reader
+        // blocks once every chunk is waiting to be written.
+        std::array<ReceivedChunk, 3> chunks;
+        std::deque<ReceivedChunk*> freeChunks;
+        std::deque<ReceivedChunk*> readyChunks;
+        bool receiving = true;
+        std::mutex chunksLock;
+        std::condition_variable chunksCondition;
+        for (auto& chunk : chunks) {
+            freeChunks.push_back(&chunk);
+        }
+        std::thread writer([&]() {
+            while (true) {
+                ReceivedChunk* chunk;
+                {
+                    std::unique_lock lock(chunksLock);
+                    chunksCondition.wait(lock,
+                                         [&] { return !readyChunks.empty() || !receiving; });
+                    if (readyChunks.empty()) {
+                        break;
+                    }
+                    chunk = readyChunks.front();
+                    readyChunks.pop_front();
+                }
+                writeInstructions(chunk->instructions);
+                {
+                    std::lock_guard lock(chunksLock);
+                    freeChunks.push_back(chunk);
+                }
+                chunksCondition.notify_all();
+            }
+        });
+
         while (!mStopReceiving) {
             const auto res = waitForData(inout);
             if (res == WaitResult::Timeout) {
@@ -807,12 +850,20 @@ private:
                 sendRequest(inout, EXIT);
                 break;
             }
-            if (!readChunk(inout, data)) {
+            ReceivedChunk* chunk;
+            {
+                std::unique_lock lock(chunksLock);
+                chunksCondition.wait(lock, [&] { return !freeChunks.empty(); });
+                chunk = freeChunks.front();
+                freeChunks.pop_front();
+            }
+            auto& instructions = chunk->instructions;
+            if (!readChunk(inout, chunk->data)) {
                 ALOGE("Failed to read a message. Abort.");
                 mStatusListener->reportStatus(DATA_LOADER_UNRECOVERABLE);
                 break;
             }
-            auto remainingData = std::span(data);
+            auto remainingData = std::span(chunk->data);
             while (!remainingData.empty()) {
                 auto header = readHeader(remainingData);
                 if (header.fileIdx == -1 && header.blockType == 0 && header.compressionType == 0 &&
@@ -859,9 +910,20 @@ private:
                 instructions.push_back(inst);
                 remainingData = remainingData.subspan(header.blockSize);
             }
-            writeInstructions(instructions);
+            {
+                std::lock_guard lock(chunksLock);
+                readyChunks.push_back(chunk);
+            }
+            chunksCondition.notify_all();
+        }
+
+        // Let the writer drain the queued chunks before the file descriptors they refer to close.
+        {
+            std::lock_guard lock(chunksLock);
+            receiving = false;
         }
-        writeInstructions(instructions);
+        chunksCondition.notify_all();
+        writer.join();
 
         {
             std::lock_guard lock{mOutFdLock};
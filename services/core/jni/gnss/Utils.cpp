@@ -18,14 +18,39 @@
 
 #include "Utils.h"
 
+#include <map>
+#include <mutex>
+#include <tuple>
+
 namespace android {
 
 namespace {
 
 thread_local std::unique_ptr<ScopedJniThreadAttach> tJniThreadAttacher;
 
+// Setter method IDs resolved by getSetterMethodID, keyed by class, name and signature. Setter
+// names are string literals from the SET macro and classes are global refs, so the raw pointers
+// are stable keys.
+std::mutex gSetterMethodIDsLock;
+std::map<std::tuple<jclass, const char*, const char*>, jmethodID> gSetterMethodIDs;
+
 } // anonymous namespace
 
+jmethodID getSetterMethodID(JNIEnv* env, jclass clazz, const char* method_name,
+                            const char* signature) {
+    const auto key = std::make_tuple(clazz, method_name, signature);
+    std::lock_guard<std::mutex> lock(gSetterMethodIDsLock);
+    auto iter = gSetterMethodIDs.find(key);
+    if (iter != gSetterMethodIDs.end()) {
+        return iter->second;
+    }
+    jmethodID method = env->GetMethodID(clazz, method_name, signature);
+    if (method != nullptr) {
+        gSetterMethodIDs.emplace(key, method);
+    }
+    return method;
+}
+
 // Define Java method signatures for all known types.
 template <>
 const char* const JavaMethodHelper<uint8_t>::signature_ = "(B)V";
@@ -103,7 +128,7 @@ template <>
 void JavaObject::callSetter(const char* method_name, uint8_t* value, size_t size) {
     jbyteArray array = env_->NewByteArray(size);
     env_->SetByteArrayRegion(array, 0, size, reinterpret_cast<jbyte*>(value));
-    jmethodID method = env_->GetMethodID(clazz_, method_name, "([B)V");
+    jmethodID method = getSetterMethodID(env_, clazz_, method_name, "([B)V");
     env_->CallVoidMethod(object_, method, array);
     env_->DeleteLocalRef(array);
 }
@@ -75,6 +75,12 @@ jboolean checkHidlReturn(hardware::Return<sp<T>>& result, const char* errorMessa
     }
 }
 
+// Returns the ID of a setter method, looking it up only on first use. Measurement callbacks set
+// dozens of fields on every satellite's GnssMeasurement, so resolving each by name per call
+// dominates translation.
+jmethodID getSetterMethodID(JNIEnv* env, jclass clazz, const char* method_name,
+                            const char* signature);
+
 template <class T>
 class JavaMethodHelper {
 public:
@@ -117,7 +123,7 @@ const char* const JavaMethodHelper<jdoubleArray>::signature_;
 template <class T>
 void JavaMethodHelper<T>::callJavaMethod(JNIEnv* env, jclass clazz, jobject object,
                                          const char* method_name, T value) {
-    jmethodID method = env->GetMethodID(clazz, method_name, signature_);
+    jmethodID method = getSetterMethodID(env, clazz, method_name, signature_);
     env->CallVoidMethod(object, method, value);
 }
 
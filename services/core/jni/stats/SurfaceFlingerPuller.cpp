@@ -76,9 +76,10 @@ AStatsManager_PullAtomCallbackReturn SurfaceFlingerPuller::parseGlobalInfoPull(
         return AStatsManager_PULL_SKIP;
     }
 
+    // The strings must outlive the BytesFields, which only have a pointer to the data. They are
+    // reused for every atom so that serializing doesn't reallocate them each time.
+    std::string frameDurationStr, renderEngineTimeStr, deadlineMissesStr, predictionErrorsStr;
     for (const auto& atom : atomList.atom()) {
-        // The strings must outlive the BytesFields, which only have a pointer to the data.
-        std::string frameDurationStr, renderEngineTimeStr, deadlineMissesStr, predictionErrorsStr;
         optional<BytesField> frameDuration = getBytes(atom.frame_duration(), frameDurationStr);
         optional<BytesField> renderEngineTime =
                 getBytes(atom.render_engine_timing(), renderEngineTimeStr);
@@ -119,10 +120,11 @@ AStatsManager_PullAtomCallbackReturn SurfaceFlingerPuller::parseLayerInfoPull(
         return AStatsManager_PULL_SKIP;
     }
 
+    // The strings must outlive the BytesFields, which only have a pointer to the data. They are
+    // reused for every atom so that serializing doesn't reallocate them each time.
+    std::string present2PresentStr, post2presentStr, acquire2PresentStr, latch2PresentStr,
+            desired2PresentStr, post2AcquireStr, frameRateVoteStr, appDeadlineMissesStr;
     for (const auto& atom : atomList.atom()) {
-        // The strings must outlive the BytesFields, which only have a pointer to the data.
-        std::string present2PresentStr, post2presentStr, acquire2PresentStr, latch2PresentStr,
-                desired2PresentStr, post2AcquireStr, frameRateVoteStr, appDeadlineMissesStr;
         optional<BytesField> present2Present =
                 getBytes(atom.present_to_present(), present2PresentStr);
         optional<BytesField> post2present = getBytes(atom.post_to_present(), post2presentStr);
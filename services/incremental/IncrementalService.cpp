@@ -419,7 +419,7 @@ void IncrementalService::onDump(int fd) {
     dprintf(fd, "IncFs features: 0x%x\n", int(mIncFs->features()));
     dprintf(fd, "Incremental dir: %s\n", mIncrementalDir.c_str());
 
-    std::unique_lock l(mLock);
+    std::shared_lock l(mLock);
 
     dprintf(fd, "Mounts (%d): {\n", int(mMounts.size()));
     for (auto&& [id, ifs] : mMounts) {
@@ -534,7 +534,7 @@ void IncrementalService::onSystemReady() {
 
     std::vector<IfsMountPtr> mounts;
     {
-        std::lock_guard l(mLock);
+        std::shared_lock l(mLock);
         mounts.reserve(mMounts.size());
         for (auto&& [id, ifs] : mMounts) {
             std::unique_lock ll(ifs->lock);
@@ -863,7 +863,7 @@ IncrementalService::BindPathMap::const_iterator IncrementalService::findStorageL
 }
 
 StorageId IncrementalService::findStorageId(std::string_view path) const {
-    std::lock_guard l(mLock);
+    std::shared_lock l(mLock);
     auto it = findStorageLocked(path);
     if (it == mBindsByPath.end()) {
         return kInvalidStorageId;
@@ -1041,7 +1041,7 @@ StorageId IncrementalService::openStorage(std::string_view pathInMount) {
 }
 
 IncrementalService::IfsMountPtr IncrementalService::getIfs(StorageId storage) const {
-    std::lock_guard l(mLock);
+    std::shared_lock l(mLock);
     return getIfsLocked(storage);
 }
 
@@ -1234,7 +1234,7 @@ int IncrementalService::makeDirs(const IncFsMount& ifs, StorageId storageId, std
 
 int IncrementalService::link(StorageId sourceStorageId, std::string_view oldPath,
                              StorageId destStorageId, std::string_view newPath) {
-    std::unique_lock l(mLock);
+    std::shared_lock l(mLock);
     auto ifsSrc = getIfsLocked(sourceStorageId);
     if (!ifsSrc) {
         return -EINVAL;
@@ -1268,7 +1268,7 @@ int IncrementalService::unlink(StorageId storage, std::string_view path) {
 int IncrementalService::addBindMount(IncFsMount& ifs, StorageId storage,
                                      std::string_view storageRoot, std::string&& source,
                                      std::string&& target, BindKind kind,
-                                     std::unique_lock<std::mutex>& mainLock) {
+                                     std::unique_lock<std::shared_mutex>& mainLock) {
     if (!isValidMountTarget(target)) {
         LOG(ERROR) << __func__ << ": invalid mount target " << target;
         return -EINVAL;
@@ -1305,7 +1305,7 @@ int IncrementalService::addBindMount(IncFsMount& ifs, StorageId storage,
 int IncrementalService::addBindMountWithMd(IncrementalService::IncFsMount& ifs, StorageId storage,
                                            std::string&& metadataName, std::string&& source,
                                            std::string&& target, BindKind kind,
-                                           std::unique_lock<std::mutex>& mainLock) {
+                                           std::unique_lock<std::shared_mutex>& mainLock) {
     {
         std::lock_guard l(mMountOperationLock);
         const auto status = mVold->bindMount(source, target);
@@ -2164,7 +2164,7 @@ int IncrementalService::setFileContent(const IfsMountPtr& ifs, const incfs::File
 
 incfs::LoadingState IncrementalService::isFileFullyLoaded(StorageId storage,
                                                           std::string_view filePath) const {
-    std::unique_lock l(mLock);
+    std::shared_lock l(mLock);
     const auto ifs = getIfsLocked(storage);
     if (!ifs) {
         LOG(ERROR) << "isFileFullyLoaded failed, invalid storageId: " << storage;
@@ -2190,7 +2190,7 @@ incfs::LoadingState IncrementalService::isMountFullyLoaded(StorageId storage) co
 
 IncrementalService::LoadingProgress IncrementalService::getLoadingProgress(
         StorageId storage) const {
-    std::unique_lock l(mLock);
+    std::shared_lock l(mLock);
     const auto ifs = getIfsLocked(storage);
     if (!ifs) {
         LOG(ERROR) << "getLoadingProgress failed, invalid storageId: " << storage;
@@ -2329,7 +2329,7 @@ void IncrementalService::onAppOpChanged(const std::string& packageName) {
 
     std::vector<IfsMountPtr> affected;
     {
-        std::lock_guard l(mLock);
+        std::shared_lock l(mLock);
         affected.reserve(mMounts.size());
         for (auto&& [id, ifs] : mMounts) {
             std::unique_lock ll(ifs->lock);
@@ -39,6 +39,7 @@
 #include <limits>
 #include <map>
 #include <mutex>
+#include <shared_mutex>
 #include <set>
 #include <span>
 #include <string>
@@ -415,11 +416,11 @@ private:
     const IfsMountPtr& getIfsLocked(StorageId storage) const;
     int addBindMount(IncFsMount& ifs, StorageId storage, std::string_view storageRoot,
                      std::string&& source, std::string&& target, BindKind kind,
-                     std::unique_lock<std::mutex>& mainLock);
+                     std::unique_lock<std::shared_mutex>& mainLock);
 
     int addBindMountWithMd(IncFsMount& ifs, StorageId storage, std::string&& metadataName,
                            std::string&& source, std::string&& target, BindKind kind,
-                           std::unique_lock<std::mutex>& mainLock);
+                           std::unique_lock<std::shared_mutex>& mainLock);
 
     void addBindMountRecordLocked(IncFsMount& ifs, StorageId storage, std::string&& metadataName,
                                   std::string&& source, std::string&& target, BindKind kind);
@@ -490,7 +491,10 @@ private:
     const std::unique_ptr<ClockWrapper> mClock;
     const std::string mIncrementalDir;
 
-    mutable std::mutex mLock;
+    // Guards mMounts, mBindsByPath and mNextId. Lookups take it shared so concurrent file operations
+    // on different storages don't serialize on each other; only adding or removing mounts and
+    // binds takes it exclusively. Per-mount state is guarded by IncFsMount::lock.
+    mutable std::shared_mutex mLock;
     mutable std::mutex mMountOperationLock;
     MountMap mMounts;
     BindPathMap mBindsByPath;
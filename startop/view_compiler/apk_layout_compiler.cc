@@ -71,11 +71,15 @@ class ResXmlVisitorAdapter {
   ResXMLParser* parser_;
 };
 
-bool CanCompileLayout(ResXMLParser* parser) {
+bool CanCompileLayout(ResXMLParser* parser, std::string* message = nullptr) {
   ResXmlVisitorAdapter adapter{parser};
   LayoutValidationVisitor visitor;
   adapter.Accept(&visitor);
 
+  if (message) {
+    *message = visitor.message();
+  }
+
   return visitor.can_compile();
 }
 
@@ -100,55 +104,56 @@ void CompileApkAssetsLayouts(const std::unique_ptr<android::ApkAssets>& assets,
       dex_file.MakeClass(StringPrintf("%s.CompiledView", package_name.c_str()))};
   std::vector<dex::MethodBuilder> methods;
 
-  assets->GetAssetsProvider()->ForEachFile("res/", [&](const android::StringPiece& s,
-                                                       android::FileType) {
-    if (s == "layout") {
-      auto path = StringPrintf("res/%s/", s.to_string().c_str());
-      assets->GetAssetsProvider()->ForEachFile(path, [&](const android::StringPiece& layout_file,
-                                                         android::FileType) {
-        auto layout_path = StringPrintf("%s%s", path.c_str(), layout_file.to_string().c_str());
-        android::ApkAssetsCookie cookie = android::kInvalidCookie;
-        auto asset = resources.OpenNonAsset(layout_path, android::Asset::ACCESS_RANDOM, &cookie);
-        CHECK(asset);
-        CHECK(android::kInvalidCookie != cookie);
-        const auto dynamic_ref_table = resources.GetDynamicRefTableForCookie(cookie);
-        CHECK(nullptr != dynamic_ref_table);
-        android::ResXMLTree xml_tree{dynamic_ref_table};
-        xml_tree.setTo(asset->getBuffer(/*wordAligned=*/true),
-                       asset->getLength(),
-                       /*copy_data=*/true);
-        android::ResXMLParser parser{xml_tree};
-        parser.restart();
-        if (CanCompileLayout(&parser)) {
-          parser.restart();
-          const std::string layout_name = startop::util::FindLayoutNameFromFilename(layout_path);
-          ResXmlVisitorAdapter adapter{&parser};
-          switch (target) {
-            case CompilationTarget::kDex: {
-              methods.push_back(compiled_view.CreateMethod(
-                  layout_name,
-                  dex::Prototype{dex::TypeDescriptor::FromClassname("android.view.View"),
-                                 dex::TypeDescriptor::FromClassname("android.content.Context"),
-                                 dex::TypeDescriptor::Int()}));
-              DexViewBuilder builder(&methods.back());
-              builder.Start();
-              LayoutCompilerVisitor visitor{&builder};
-              adapter.Accept(&visitor);
-              builder.Finish();
-              methods.back().Encode();
-              break;
-            }
-            case CompilationTarget::kJavaLanguage: {
-              JavaLangViewBuilder builder{package_name, layout_name, target_out};
-              builder.Start();
-              LayoutCompilerVisitor visitor{&builder};
-              adapter.Accept(&visitor);
-              builder.Finish();
-              break;
-            }
-          }
+  // Each ForEachFile call walks the whole central directory of the APK, so list res/layout/
+  // directly rather than scanning res/ for it first.
+  const std::string path{"res/layout/"};
+  assets->GetAssetsProvider()->ForEachFile(path, [&](const android::StringPiece& layout_file,
+                                                     android::FileType) {
+    auto layout_path = StringPrintf("%s%s", path.c_str(), layout_file.to_string().c_str());
+    android::ApkAssetsCookie cookie = android::kInvalidCookie;
+    auto asset = resources.OpenNonAsset(layout_path, android::Asset::ACCESS_BUFFER, &cookie);
+    CHECK(asset);
+    CHECK(android::kInvalidCookie != cookie);
+    const auto dynamic_ref_table = resources.GetDynamicRefTableForCookie(cookie);
+    CHECK(nullptr != dynamic_ref_table);
+    // The asset outlives the tree, so parse its buffer in place.
+    android::ResXMLTree xml_tree{dynamic_ref_table};
+    xml_tree.setTo(asset->getBuffer(/*wordAligned=*/true),
+                   asset->getLength(),
+                   /*copy_data=*/false);
+    android::ResXMLParser parser{xml_tree};
+    parser.restart();
+    std::string message;
+    if (!CanCompileLayout(&parser, &message)) {
+      LOG(INFO) << "Not compiling " << layout_path << ": " << message;
+    } else {
+      parser.restart();
+      const std::string layout_name = startop::util::FindLayoutNameFromFilename(layout_path);
+      ResXmlVisitorAdapter adapter{&parser};
+      switch (target) {
+        case CompilationTarget::kDex: {
+          methods.push_back(compiled_view.CreateMethod(
+              layout_name,
+              dex::Prototype{dex::TypeDescriptor::FromClassname("android.view.View"),
+                             dex::TypeDescriptor::FromClassname("android.content.Context"),
+                             dex::TypeDescriptor::Int()}));
+          DexViewBuilder builder(&methods.back());
+          builder.Start();
+          LayoutCompilerVisitor visitor{&builder};
+          adapter.Accept(&visitor);
+          builder.Finish();
+          methods.back().Encode();
+          break;
         }
-      });
+        case CompilationTarget::kJavaLanguage: {
+          JavaLangViewBuilder builder{package_name, layout_name, target_out};
+          builder.Start();
+          LayoutCompilerVisitor visitor{&builder};
+          adapter.Accept(&visitor);
+          builder.Finish();
+          break;
+        }
+      }
     }
   });
 
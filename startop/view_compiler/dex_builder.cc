@@ -234,13 +234,13 @@ ClassBuilder DexBuilder::MakeClass(const std::string& name) {
 }
 
 ir::Type* DexBuilder::GetOrAddType(const std::string& descriptor) {
-  if (types_by_descriptor_.find(descriptor) != types_by_descriptor_.end()) {
-    return types_by_descriptor_[descriptor];
+  ir::Type*& type = types_by_descriptor_[descriptor];
+  if (type != nullptr) {
+    return type;
   }
 
-  ir::Type* type = Alloc<ir::Type>();
+  type = Alloc<ir::Type>();
   type->descriptor = GetOrAddString(descriptor);
-  types_by_descriptor_[descriptor] = type;
   type->orig_index = dex_file_->types_indexes.AllocateIndex();
   dex_file_->types_map[type->orig_index] = type;
   return type;
@@ -248,18 +248,17 @@ ir::Type* DexBuilder::GetOrAddType(const std::string& descriptor) {
 
 ir::FieldDecl* DexBuilder::GetOrAddField(TypeDescriptor parent, const std::string& name,
                                          TypeDescriptor type) {
-  const auto key = std::make_tuple(parent, name);
-  if (field_decls_by_key_.find(key) != field_decls_by_key_.end()) {
-    return field_decls_by_key_[key];
+  ir::FieldDecl*& field = field_decls_by_key_[std::make_tuple(parent, name)];
+  if (field != nullptr) {
+    return field;
   }
 
-  ir::FieldDecl* field = Alloc<ir::FieldDecl>();
+  field = Alloc<ir::FieldDecl>();
   field->parent = GetOrAddType(parent);
   field->name = GetOrAddString(name);
   field->type = GetOrAddType(type);
   field->orig_index = dex_file_->fields_indexes.AllocateIndex();
   dex_file_->fields_map[field->orig_index] = field;
-  field_decls_by_key_[key] = field;
   return field;
 }
 
@@ -657,9 +656,10 @@ void MethodBuilder::BindLabel(const Value& label_id) {
 
 const MethodDeclData& DexBuilder::GetOrDeclareMethod(TypeDescriptor type, const std::string& name,
                                                      Prototype prototype) {
-  MethodDeclData& entry = method_id_map_[{type, name, prototype}];
+  auto [it, inserted] = method_id_map_.try_emplace(MethodDescriptor{type, name, prototype});
+  MethodDeclData& entry = it->second;
 
-  if (entry.decl == nullptr) {
+  if (inserted) {
     // This method has not already been declared, so declare it.
     ir::MethodDecl* decl = dex_file_->Alloc<ir::MethodDecl>();
     // The method id is the last added method.
@@ -678,18 +678,19 @@ const MethodDeclData& DexBuilder::GetOrDeclareMethod(TypeDescriptor type, const
     decl->orig_index = decl->index = new_index;
 
     entry = {id, decl};
+    // std::map nodes are stable, so the key's prototype can be referenced directly.
+    prototypes_by_method_id_[id] = &it->first.prototype;
   }
 
   return entry;
 }
 
 std::optional<const Prototype> DexBuilder::GetPrototypeByMethodId(size_t method_id) const {
-  for (const auto& entry : method_id_map_) {
-    if (entry.second.id == method_id) {
-      return entry.first.prototype;
-    }
+  auto it = prototypes_by_method_id_.find(method_id);
+  if (it == prototypes_by_method_id_.end()) {
+    return {};
   }
-  return {};
+  return *it->second;
 }
 
 ir::Proto* DexBuilder::GetOrEncodeProto(Prototype prototype) {
@@ -598,6 +598,9 @@ class DexBuilder {
   // the methods list.
   std::map<MethodDescriptor, MethodDeclData> method_id_map_;
 
+  // The reverse of method_id_map_, so invoke encoding does not scan every declared method.
+  std::unordered_map<size_t, const Prototype*> prototypes_by_method_id_;
+
   // Keep track of what strings we've defined so we can look them up later.
   std::unordered_map<std::string, ir::String*> strings_;
 
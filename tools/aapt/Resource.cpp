@@ -19,6 +19,7 @@
 #include "XMLNode.h"
 
 #include <algorithm>
+#include <thread>
 
 // STATUST: mingw does seem to redefine UNKNOWN_ERROR from our enum value, so a cast is necessary.
 
@@ -31,8 +32,15 @@
 // Set to true for noisy debug output.
 static const bool kIsDebug = false;
 
-// Number of threads to use for preprocessing images.
-static const size_t MAX_THREADS = 4;
+// Number of threads to use for preprocessing images when the host core count is unknown,
+// and the most we will ever use. Crunching is CPU bound, so scale with the machine.
+static const size_t DEFAULT_THREADS = 4;
+static const size_t MAX_THREADS = 16;
+
+static size_t getPreProcessThreadCount() {
+    const size_t cpus = std::thread::hardware_concurrency();
+    return cpus == 0 ? DEFAULT_THREADS : std::min(cpus, MAX_THREADS);
+}
 
 // ==========================================================================
 // ==========================================================================
@@ -367,7 +375,7 @@ static status_t preProcessImages(const Bundle* bundle, const sp<AaptAssets>& ass
     volatile bool hasErrors = false;
     ssize_t res = NO_ERROR;
     if (bundle->getUseCrunchCache() == false) {
-        WorkQueue wq(MAX_THREADS, false);
+        WorkQueue wq(getPreProcessThreadCount(), false);
         ResourceDirIterator it(set, String8(type));
         while ((res=it.next()) == NO_ERROR) {
             PreProcessImageWorkUnit* w = new PreProcessImageWorkUnit(
@@ -16,6 +16,8 @@
 
 #include "LoadedApk.h"
 
+#include "google/protobuf/arena.h"
+
 #include "ResourceValues.h"
 #include "ValueVisitor.h"
 #include "format/Archive.h"
@@ -99,7 +101,11 @@ std::unique_ptr<LoadedApk> LoadedApk::LoadProtoApkFromFileCollection(
 
   io::IFile* table_file = collection->FindFile(kProtoResourceTablePath);
   if (table_file != nullptr) {
-    pb::ResourceTable pb_table;
+    // The proto table is only an intermediate form, so build it on an arena: parsing then does
+    // bump allocations instead of one heap allocation per message and string, and the whole tree
+    // is released at once after deserialization.
+    google::protobuf::Arena arena;
+    pb::ResourceTable* pb_table = google::protobuf::Arena::CreateMessage<pb::ResourceTable>(&arena);
     std::unique_ptr<io::InputStream> in = table_file->OpenInputStream();
     if (in == nullptr) {
       diag->Error(DiagMessage(source) << "failed to open " << kProtoResourceTablePath);
@@ -107,14 +113,14 @@ std::unique_ptr<LoadedApk> LoadedApk::LoadProtoApkFromFileCollection(
     }
 
     io::ProtoInputStreamReader proto_reader(in.get());
-    if (!proto_reader.ReadMessage(&pb_table)) {
+    if (!proto_reader.ReadMessage(pb_table)) {
       diag->Error(DiagMessage(source) << "failed to read " << kProtoResourceTablePath);
       return {};
     }
 
     std::string error;
     table = util::make_unique<ResourceTable>(ResourceTable::Validation::kDisabled);
-    if (!DeserializeTableFromPb(pb_table, collection.get(), table.get(), &error)) {
+    if (!DeserializeTableFromPb(*pb_table, collection.get(), table.get(), &error)) {
       diag->Error(DiagMessage(source)
                   << "failed to deserialize " << kProtoResourceTablePath << ": " << error);
       return {};
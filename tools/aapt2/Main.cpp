@@ -101,8 +101,10 @@ class DaemonCommand : public Command {
       : Command("daemon", "m"), out_(out), diagnostics_(diagnostics) {
     SetDescription("Runs aapt in daemon mode. Each subsequent line is a single parameter to the\n"
         "command. The end of an invocation is signaled by providing an empty line.");
-    AddOptionalFlag("--trace_folder", "Generate systrace json trace fragment to specified folder.",
-                    &trace_folder_);
+    AddOptionalFlag("--trace_folder",
+        "Generate systrace json trace fragment to specified folder, along with a\n"
+            "summary of the time spent per traced phase and the peak RSS.",
+        &trace_folder_);
   }
 
   int Action(const std::vector<std::string>& arguments) override {
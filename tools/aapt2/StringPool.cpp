@@ -364,11 +364,27 @@ static size_t EncodedLengthUnits(size_t length) {
 
 const std::string kStringTooLarge = "STRING_TOO_LARGE";
 
+static bool IsAscii(const std::string& str) {
+  for (char c : str) {
+    if (static_cast<uint8_t>(c) >= 0x80) {
+      return false;
+    }
+  }
+  return true;
+}
+
 static bool EncodeString(const std::string& str, const bool utf8, BigBuffer* out,
                          IDiagnostics* diag) {
+  // Most pool strings (resource names, file paths) are ASCII. Those are already valid Modified
+  // UTF-8 and have a UTF-16 length equal to their byte length, so they can skip the conversions.
+  const bool ascii = IsAscii(str);
   if (utf8) {
-    const std::string& encoded = util::Utf8ToModifiedUtf8(str);
-    const ssize_t utf16_length = utf8_to_utf16_length(
+    std::string modified;
+    if (!ascii) {
+      modified = util::Utf8ToModifiedUtf8(str);
+    }
+    const std::string& encoded = ascii ? str : modified;
+    const ssize_t utf16_length = ascii ? encoded.size() : utf8_to_utf16_length(
         reinterpret_cast<const uint8_t*>(encoded.data()), encoded.size());
     CHECK(utf16_length >= 0);
 
@@ -396,6 +412,14 @@ static bool EncodeString(const std::string& str, const bool utf8, BigBuffer* out
     data = EncodeLength(data, encoded.size());
     strncpy(data, encoded.data(), encoded.size());
 
+  } else if (ascii && str.size() <= EncodeLengthMax<char16_t>()) {
+    char16_t* data = out->NextBlock<char16_t>(EncodedLengthUnits<char16_t>(str.size())
+        + str.size() + 1);
+    data = EncodeLength(data, str.size());
+    for (char c : str) {
+      *data++ = static_cast<char16_t>(c);
+    }
+
   } else {
     const std::u16string encoded = util::Utf8ToUtf16(str);
     const ssize_t utf16_length = encoded.size();
@@ -17,7 +17,9 @@
 #include "Compile.h"
 
 #include <dirent.h>
+#include <atomic>
 #include <string>
+#include <thread>
 
 #include "android-base/errors.h"
 #include "android-base/file.h"
@@ -30,6 +32,7 @@
 #include "Diagnostics.h"
 #include "ResourceParser.h"
 #include "ResourceTable.h"
+#include "ResourceUtils.h"
 #include "cmd/Util.h"
 #include "compile/IdAssigner.h"
 #include "compile/InlineXmlFormatParser.h"
@@ -638,11 +641,175 @@ class CompileContext : public IAaptContext {
   bool verbose_ = false;
 };
 
+// Holds the diagnostics of a single file compiled on a worker thread, so they can be replayed in
+// input order once all workers are done.
+class BufferedDiagnostics : public IDiagnostics {
+ public:
+  BufferedDiagnostics() = default;
+
+  void Log(Level level, DiagMessageActual& actual_msg) override {
+    messages_.emplace_back(level, actual_msg);
+  }
+
+  void ReplayTo(IDiagnostics* diag) {
+    for (auto& message : messages_) {
+      diag->Log(message.first, message.second);
+    }
+    messages_.clear();
+  }
+
+ private:
+  DISALLOW_COPY_AND_ASSIGN(BufferedDiagnostics);
+
+  std::vector<std::pair<Level, DiagMessageActual>> messages_;
+};
+
+// Holds the entries written for a single file compiled on a worker thread, so they can be
+// committed to the real archive in input order and the output stays byte-for-byte deterministic.
+class BufferedArchiveWriter : public IArchiveWriter {
+ public:
+  BufferedArchiveWriter() = default;
+
+  bool WriteFile(const StringPiece& path, uint32_t flags, io::InputStream* in) override {
+    if (!StartEntry(path, flags)) {
+      return false;
+    }
+
+    const void* data = nullptr;
+    size_t len = 0;
+    while (in->Next(&data, &len)) {
+      if (!Write(data, static_cast<int>(len))) {
+        return false;
+      }
+    }
+
+    if (in->HadError()) {
+      error_ = in->GetError();
+      return false;
+    }
+    return FinishEntry();
+  }
+
+  bool StartEntry(const StringPiece& path, uint32_t flags) override {
+    entries_.push_back(Entry{path.to_string(), flags, {}});
+    return true;
+  }
+
+  bool Write(const void* buffer, int size) override {
+    if (entries_.empty()) {
+      error_ = "no entry started";
+      return false;
+    }
+    entries_.back().data.append(reinterpret_cast<const char*>(buffer), size);
+    return true;
+  }
+
+  bool FinishEntry() override {
+    return true;
+  }
+
+  bool HadError() const override {
+    return !error_.empty();
+  }
+
+  std::string GetError() const override {
+    return error_;
+  }
+
+  bool CommitTo(IArchiveWriter* writer) {
+    for (const Entry& entry : entries_) {
+      io::StringInputStream in(entry.data);
+      if (!writer->WriteFile(entry.path, entry.flags, &in)) {
+        return false;
+      }
+    }
+    entries_.clear();
+    return true;
+  }
+
+ private:
+  DISALLOW_COPY_AND_ASSIGN(BufferedArchiveWriter);
+
+  struct Entry {
+    std::string path;
+    uint32_t flags;
+    std::string data;
+  };
+
+  std::vector<Entry> entries_;
+  std::string error_;
+};
+
+using CompileFunc = bool (*)(IAaptContext*, const CompileOptions&, const ResourcePathData&,
+                             io::IFile*, IArchiveWriter*, const std::string&);
+
+struct CompileJob {
+  io::IFile* file;
+  ResourcePathData path_data;
+  CompileFunc compile_func;
+  std::string out_path;
+};
+
+// Compiles every job on a pool of worker threads. Each job gets its own context, diagnostics and
+// archive buffer; results are then flushed to the caller's diagnostics and writer in job order.
+static bool CompileJobsInParallel(IAaptContext* context, const CompileOptions& options,
+                                  std::vector<CompileJob>& jobs, IArchiveWriter* output_writer) {
+  struct JobResult {
+    BufferedDiagnostics diag;
+    BufferedArchiveWriter writer;
+    bool success = false;
+  };
+  std::vector<JobResult> results(jobs.size());
+  std::atomic<size_t> next_job(0);
+
+  auto worker = [&]() {
+    size_t i;
+    while ((i = next_job.fetch_add(1)) < jobs.size()) {
+      CompileContext job_context(&results[i].diag);
+      job_context.SetVerbose(context->IsVerbose());
+      const CompileJob& job = jobs[i];
+      results[i].success = job.compile_func(&job_context, options, job.path_data, job.file,
+                                            &results[i].writer, job.out_path);
+    }
+  };
+
+  std::vector<std::thread> threads;
+  const size_t thread_count = std::min(options.jobs, jobs.size());
+  for (size_t i = 1; i < thread_count; i++) {
+    threads.emplace_back(worker);
+  }
+  worker();
+  for (std::thread& thread : threads) {
+    thread.join();
+  }
+
+  bool error = false;
+  for (size_t i = 0; i < jobs.size(); i++) {
+    results[i].diag.ReplayTo(context->GetDiagnostics());
+    if (!results[i].success) {
+      context->GetDiagnostics()->Error(DiagMessage(jobs[i].file->GetSource())
+                                       << "file failed to compile");
+      error = true;
+    } else if (!results[i].writer.CommitTo(output_writer)) {
+      context->GetDiagnostics()->Error(DiagMessage(jobs[i].out_path)
+                                       << "failed to write entry data");
+      error = true;
+    }
+  }
+  return !error;
+}
+
 int Compile(IAaptContext* context, io::IFileCollection* inputs, IArchiveWriter* output_writer,
              CompileOptions& options) {
   TRACE_CALL();
   bool error = false;
 
+  // Reading from a shared zip archive is not safe across threads, and every compiled file rewrites
+  // the --output-text-symbols file, so which one wins would depend on thread timing.
+  const bool parallel =
+      options.jobs > 1 && !options.res_zip && !options.generate_text_symbols_path;
+  std::vector<CompileJob> jobs;
+
   // Iterate over the input files in a stable, platform-independent manner
   auto file_iterator  = inputs->Iterator();
   while (file_iterator->HasNext()) {
@@ -672,7 +839,7 @@ int Compile(IAaptContext* context, io::IFileCollection* inputs, IArchiveWriter*
     }
 
     // Determine how to compile the file based on its type.
-    auto compile_func = &CompileFile;
+    CompileFunc compile_func = &CompileFile;
     if (path_data.resource_dir == "values" && path_data.extension == "xml") {
       compile_func = &CompileTable;
       // We use a different extension (not necessary anymore, but avoids altering the existing
@@ -707,12 +874,18 @@ int Compile(IAaptContext* context, io::IFileCollection* inputs, IArchiveWriter*
     }
 
     const std::string out_path = BuildIntermediateContainerFilename(path_data);
-    if (!compile_func(context, options, path_data, file, output_writer, out_path)) {
+    if (parallel) {
+      jobs.push_back(CompileJob{file, std::move(path_data), compile_func, out_path});
+    } else if (!compile_func(context, options, path_data, file, output_writer, out_path)) {
       context->GetDiagnostics()->Error(DiagMessage(file->GetSource()) << "file failed to compile");
       error = true;
     }
   }
 
+  if (!jobs.empty() && !CompileJobsInParallel(context, options, jobs, output_writer)) {
+    error = true;
+  }
+
   return error ? 1 : 0;
 }
 
@@ -736,6 +909,16 @@ int CompileCommand::Action(const std::vector<std::string>& args) {
     }
   }
 
+  if (jobs_) {
+    Maybe<uint32_t> maybe_jobs = ResourceUtils::ParseInt(jobs_.value());
+    if (!maybe_jobs || maybe_jobs.value() == 0) {
+      context.GetDiagnostics()->Error(DiagMessage() << "-j requires a positive integer, got '"
+                                                    << jobs_.value() << "'");
+      return 1;
+    }
+    options_.jobs = maybe_jobs.value();
+  }
+
   std::unique_ptr<io::IFileCollection> file_collection;
 
   // Collect the resources files to compile
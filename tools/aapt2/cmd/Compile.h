@@ -39,6 +39,9 @@ struct CompileOptions {
   // See comments on aapt::ResourceParserOptions.
   bool preserve_visibility_of_styleables = false;
   bool verbose = false;
+  // Number of files to compile concurrently. Output and diagnostics are still emitted in
+  // input order.
+  size_t jobs = 1;
 };
 
 /** Parses flags and compiles resources to be used in linking.  */
@@ -68,8 +71,13 @@ class CompileCommand : public Command {
         "Sets the visibility of the compiled resources to the specified\n"
             "level. Accepted levels: public, private, default", &visibility_);
     AddOptionalSwitch("-v", "Enables verbose logging", &options_.verbose);
-    AddOptionalFlag("--trace-folder", "Generate systrace json trace fragment to specified folder.",
-                    &trace_folder_);
+    AddOptionalFlag("-j",
+        "Number of files to compile in parallel. Output is identical to a serial\n"
+            "compile. Ignored with --zip or --output-text-symbols.", &jobs_);
+    AddOptionalFlag("--trace-folder",
+        "Generate systrace json trace fragment to specified folder, along with a\n"
+            "summary of the time spent per traced phase and the peak RSS.",
+        &trace_folder_);
     AddOptionalFlag("--source-path",
                       "Sets the compiled resource file source file path to the given string.",
                       &options_.source_path);
@@ -82,6 +90,7 @@ class CompileCommand : public Command {
   CompileOptions options_;
   Maybe<std::string> visibility_;
   Maybe<std::string> trace_folder_;
+  Maybe<std::string> jobs_;
 };
 
 int Compile(IAaptContext* context, io::IFileCollection* inputs, IArchiveWriter* output_writer,
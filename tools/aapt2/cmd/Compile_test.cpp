@@ -141,6 +141,34 @@ TEST_F(CompilerTest, DirInput) {
   ASSERT_EQ(::android::base::utf8::unlink(kOutputFlata.c_str()), 0);
 }
 
+TEST_F(CompilerTest, DirInputParallel) {
+  StdErrDiagnostics diag;
+  const std::string kResDir = BuildPath({android::base::Dirname(android::base::GetExecutablePath()),
+                                         "integration-tests", "CompileTest", "DirInput", "res"});
+  const std::string kSerialFlata =
+      BuildPath({android::base::Dirname(android::base::GetExecutablePath()), "integration-tests",
+                 "CompileTest", "DirInput", "serial.flata"});
+  const std::string kParallelFlata =
+      BuildPath({android::base::Dirname(android::base::GetExecutablePath()), "integration-tests",
+                 "CompileTest", "DirInput", "parallel.flata"});
+  ::android::base::utf8::unlink(kSerialFlata.c_str());
+  ::android::base::utf8::unlink(kParallelFlata.c_str());
+
+  ASSERT_EQ(CompileCommand(&diag).Execute({"--dir", kResDir, "-o", kSerialFlata}, &std::cerr), 0);
+  ASSERT_EQ(CompileCommand(&diag).Execute({"--dir", kResDir, "-o", kParallelFlata, "-j", "4"},
+                                          &std::cerr), 0);
+
+  // Entries must be written in the same order with the same contents.
+  std::string serial;
+  std::string parallel;
+  ASSERT_TRUE(android::base::ReadFileToString(kSerialFlata, &serial));
+  ASSERT_TRUE(android::base::ReadFileToString(kParallelFlata, &parallel));
+  EXPECT_EQ(serial, parallel);
+
+  ASSERT_EQ(::android::base::utf8::unlink(kSerialFlata.c_str()), 0);
+  ASSERT_EQ(::android::base::utf8::unlink(kParallelFlata.c_str()), 0);
+}
+
 TEST_F(CompilerTest, ZipInput) {
   StdErrDiagnostics diag;
   std::unique_ptr<IAaptContext> context = test::ContextBuilder().Build();
@@ -374,6 +374,33 @@ static void ZeroOutAppReferences(ResourceTable* table) {
   VisitAllValuesInTable(table, &visitor);
 }
 
+// Returns true if both APKs contain byte-identical resource tables. Their diff is then empty, and
+// walking both tables can be skipped.
+static bool HaveIdenticalResourceTables(LoadedApk* apk_a, LoadedApk* apk_b) {
+  io::IFileCollection* zip_a = apk_a->GetFileCollection();
+  io::IFileCollection* zip_b = apk_b->GetFileCollection();
+  bool found_table = false;
+  for (const char* table_path : {kApkResourceTablePath, kProtoResourceTablePath}) {
+    io::IFile* file_a = zip_a->FindFile(table_path);
+    io::IFile* file_b = zip_b->FindFile(table_path);
+    if (file_a == nullptr && file_b == nullptr) {
+      continue;
+    }
+    if (file_a == nullptr || file_b == nullptr) {
+      return false;
+    }
+
+    std::unique_ptr<io::IData> data_a = file_a->OpenAsData();
+    std::unique_ptr<io::IData> data_b = file_b->OpenAsData();
+    if (!data_a || !data_b || data_a->size() != data_b->size() ||
+        memcmp(data_a->data(), data_b->data(), data_a->size()) != 0) {
+      return false;
+    }
+    found_table = true;
+  }
+  return found_table;
+}
+
 int DiffCommand::Action(const std::vector<std::string>& args) {
   DiffContext context;
 
@@ -390,6 +417,11 @@ int DiffCommand::Action(const std::vector<std::string>& args) {
     return 1;
   }
 
+  // Only checked once both APKs loaded, so that unreadable inputs still fail.
+  if (HaveIdenticalResourceTables(apk_a.get(), apk_b.get())) {
+    return 0;
+  }
+
   // Zero out Application IDs in references.
   ZeroOutAppReferences(apk_a->GetResourceTable());
   ZeroOutAppReferences(apk_b->GetResourceTable());
@@ -304,7 +304,8 @@ class LinkCommand : public Command {
             "Protobuf format.",
         &options_.proto_table_flattener_options.exclude_sources);
     AddOptionalFlag("--trace-folder",
-        "Generate systrace json trace fragment to specified folder.",
+        "Generate systrace json trace fragment to specified folder, along with a\n"
+            "summary of the time spent per traced phase and the peak RSS.",
         &trace_folder_);
     AddOptionalSwitch("--merge-only",
         "Only merge the resources, without verifying resource references. This flag\n"
@@ -20,6 +20,7 @@
 #include <zlib.h>
 
 #include <algorithm>
+#include <string>
 #include <unordered_map>
 #include <unordered_set>
 
@@ -531,6 +532,14 @@ bool WritePng(IAaptContext* context, const Image* image,
   bool grayscale = true;
   int max_gray_deviation = 0;
 
+  // Once more than 256 distinct colors are seen the image can no longer be palettized, so stop
+  // growing the palettes; past that point only whether any pixel is translucent still matters.
+  bool palette_overflow = false;
+
+  // Runs of identical pixels are common, and repeat the analysis of the previous pixel exactly.
+  bool has_last_color = false;
+  uint32_t last_color = 0;
+
   for (int32_t y = 0; y < image->height; y++) {
     const uint8_t* row = image->rows[y];
     for (int32_t x = 0; x < image->width; x++) {
@@ -549,13 +558,24 @@ bool WritePng(IAaptContext* context, const Image* image,
         red = green = blue = 0;
       }
 
-      // Insert the color into the color palette.
       const uint32_t color = red << 24 | green << 16 | blue << 8 | alpha;
-      color_palette[color] = -1;
-
-      // If the pixel has non-opaque alpha, insert it into the
-      // alpha palette.
-      if (alpha != 0xff) {
+      if (has_last_color && color == last_color) {
+        continue;
+      }
+      has_last_color = true;
+      last_color = color;
+
+      if (!palette_overflow) {
+        // Insert the color into the color palette.
+        color_palette[color] = -1;
+        palette_overflow = color_palette.size() > 256;
+
+        // If the pixel has non-opaque alpha, insert it into the
+        // alpha palette.
+        if (alpha != 0xff) {
+          alpha_palette.insert(color);
+        }
+      } else if (alpha != 0xff && alpha_palette.empty()) {
         alpha_palette.insert(color);
       }
 
@@ -576,7 +596,7 @@ bool WritePng(IAaptContext* context, const Image* image,
 
   if (context->IsVerbose()) {
     DiagMessage msg;
-    msg << " paletteSize=" << color_palette.size()
+    msg << " paletteSize=" << (palette_overflow ? ">256" : std::to_string(color_palette.size()))
         << " alphaPaletteSize=" << alpha_palette.size()
         << " maxGrayDeviation=" << max_gray_deviation
         << " grayScale=" << (grayscale ? "true" : "false");
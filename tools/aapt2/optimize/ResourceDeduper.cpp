@@ -64,6 +64,10 @@ class DominatedKeyValueRemover : public DominatorTree::BottomUpVisitor {
     // equivalent.
     const ConfigDescription& node_configuration = node_value->config;
     for (const auto& sibling : parent->children()) {
+      if (sibling.get() == node) {
+        // A value trivially equals itself; skip the deep comparison.
+        continue;
+      }
       ResourceConfigValue* sibling_value = sibling->value();
       if (!sibling_value->value) {
         // Sibling was already removed.
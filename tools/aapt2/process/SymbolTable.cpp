@@ -16,7 +16,10 @@
 
 #include "process/SymbolTable.h"
 
+#include <sys/stat.h>
+
 #include <iostream>
+#include <map>
 
 #include "android-base/logging.h"
 #include "android-base/stringprintf.h"
@@ -218,13 +221,61 @@ std::unique_ptr<SymbolTable::Symbol> ResourceTableSymbolSource::FindByName(
   return symbol;
 }
 
+// When several commands run in one process (aapt2 daemon), every link would otherwise reload and
+// re-parse the same include paths, typically android.jar. ApkAssets are immutable, so they are
+// shared between links for as long as the file on disk is unchanged.
+static std::shared_ptr<const ApkAssets> LoadApkAssetsCached(const std::string& path) {
+#ifdef _WIN32
+  return ApkAssets::Load(path);
+#else
+  struct CachedApkAssets {
+    dev_t dev;
+    ino_t ino;
+    off_t size;
+    struct timespec mtime;
+    std::shared_ptr<const ApkAssets> apk_assets;
+  };
+  static std::map<std::string, CachedApkAssets> cache;
+  constexpr size_t kMaxCachedApkAssets = 16;
+
+  struct stat sb;
+  if (stat(path.c_str(), &sb) != 0) {
+    return ApkAssets::Load(path);
+  }
+#ifdef __APPLE__
+  const struct timespec mtime = sb.st_mtimespec;
+#else
+  const struct timespec mtime = sb.st_mtim;
+#endif
+
+  auto iter = cache.find(path);
+  if (iter != cache.end()) {
+    const CachedApkAssets& entry = iter->second;
+    if (entry.dev == sb.st_dev && entry.ino == sb.st_ino && entry.size == sb.st_size &&
+        entry.mtime.tv_sec == mtime.tv_sec && entry.mtime.tv_nsec == mtime.tv_nsec) {
+      return entry.apk_assets;
+    }
+    cache.erase(iter);
+  }
+
+  std::shared_ptr<const ApkAssets> apk_assets = ApkAssets::Load(path);
+  if (apk_assets != nullptr) {
+    if (cache.size() >= kMaxCachedApkAssets) {
+      cache.clear();
+    }
+    cache[path] = CachedApkAssets{sb.st_dev, sb.st_ino, sb.st_size, mtime, apk_assets};
+  }
+  return apk_assets;
+#endif
+}
+
 bool AssetManagerSymbolSource::AddAssetPath(const StringPiece& path) {
   TRACE_CALL();
-  if (std::unique_ptr<const ApkAssets> apk = ApkAssets::Load(path.data())) {
+  if (std::shared_ptr<const ApkAssets> apk = LoadApkAssetsCached(path.to_string())) {
     apk_assets_.push_back(std::move(apk));
 
     std::vector<const ApkAssets*> apk_assets;
-    for (const std::unique_ptr<const ApkAssets>& apk_asset : apk_assets_) {
+    for (const std::shared_ptr<const ApkAssets>& apk_asset : apk_assets_) {
       apk_assets.push_back(apk_asset.get());
     }
 
@@ -251,7 +302,7 @@ bool AssetManagerSymbolSource::IsPackageDynamic(uint32_t packageId,
     return true;
   }
 
-  for (const std::unique_ptr<const ApkAssets>& assets : apk_assets_) {
+  for (const std::shared_ptr<const ApkAssets>& assets : apk_assets_) {
     for (const std::unique_ptr<const android::LoadedPackage>& loaded_package
          : assets->GetLoadedArsc()->GetPackages()) {
       if (package_name == loaded_package->GetPackageName() && loaded_package->IsDynamic()) {
@@ -208,7 +208,8 @@ class AssetManagerSymbolSource : public ISymbolSource {
 
  private:
   android::AssetManager2 asset_manager_;
-  std::vector<std::unique_ptr<const android::ApkAssets>> apk_assets_;
+  // Shared with the process-wide cache of loaded include paths, see AddAssetPath.
+  std::vector<std::shared_ptr<const android::ApkAssets>> apk_assets_;
 
   DISALLOW_COPY_AND_ASSIGN(AssetManagerSymbolSource);
 };
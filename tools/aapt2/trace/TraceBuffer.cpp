@@ -16,11 +16,18 @@
 
 #include "TraceBuffer.h"
 
+#include <atomic>
 #include <chrono>
+#include <map>
+#include <mutex>
 #include <sstream>
 #include <unistd.h>
 #include <vector>
 
+#ifndef _WIN32
+#include <sys/resource.h>
+#endif
+
 #include <inttypes.h>
 
 #include "android-base/utf8.h"
@@ -37,22 +44,64 @@ constexpr char kEnd = 'E';
 
 struct TracePoint {
   pid_t tid;
+  int thread;
   int64_t time;
   std::string tag;
   char type;
 };
 
 std::vector<TracePoint> traces;
+std::mutex traces_lock;
+
+// Small sequential ids, so events from parallel compile workers land on separate tracks.
+int GetThreadIndex() noexcept {
+  static std::atomic<int> next_index(0);
+  thread_local int index = next_index.fetch_add(1);
+  return index;
+}
 
 int64_t GetTime() noexcept {
   auto now = std::chrono::steady_clock::now();
   return std::chrono::duration_cast<std::chrono::microseconds>(now.time_since_epoch()).count();
 }
 
+// Tags can hold file names and command arguments, so escape them before writing a JSON string.
+std::string EscapeJson(const std::string& value) {
+  std::string escaped;
+  escaped.reserve(value.size());
+  for (char c : value) {
+    switch (c) {
+      case '"':
+        escaped += "\\\"";
+        break;
+      case '\\':
+        escaped += "\\\\";
+        break;
+      case '\n':
+        escaped += "\\n";
+        break;
+      case '\t':
+        escaped += "\\t";
+        break;
+      default:
+        if (static_cast<unsigned char>(c) < 0x20) {
+          char buffer[7];
+          snprintf(buffer, sizeof(buffer), "\\u%04x", c);
+          escaped += buffer;
+        } else {
+          escaped += c;
+        }
+        break;
+    }
+  }
+  return escaped;
+}
+
 } // namespace anonymous
 
 void AddWithTime(const std::string& tag, char type, int64_t time) noexcept {
-  TracePoint t = {getpid(), time, tag, type};
+  TracePoint t = {getpid(), GetThreadIndex(), time, tag, type};
+  std::lock_guard<std::mutex> lock(traces_lock);
   traces.emplace_back(t);
 }
 
@@ -63,9 +112,66 @@ void Add(const std::string& tag, char type) noexcept {
 
 
 
+// Peak resident set size of the process in KB, or -1 where unavailable.
+static int64_t GetPeakRssKb() {
+#ifdef _WIN32
+  return -1;
+#else
+  struct rusage usage;
+  if (getrusage(RUSAGE_SELF, &usage) != 0) {
+    return -1;
+  }
+#ifdef __APPLE__
+  return usage.ru_maxrss / 1024;
+#else
+  return usage.ru_maxrss;
+#endif
+#endif
+}
+
+// Writes total time and call count per trace tag, plus peak RSS, so a build regression can be
+// attributed to a phase without loading the full event trace into a viewer.
+static void WriteSummary(const std::string& basePath) {
+  struct Totals {
+    int64_t count = 0;
+    int64_t micros = 0;
+  };
+  std::map<std::string, Totals> totals;
+  std::map<int, std::vector<const TracePoint*>> open_traces;
+  for (const TracePoint& trace : traces) {
+    std::vector<const TracePoint*>& stack = open_traces[trace.thread];
+    if (trace.type == kBegin) {
+      stack.push_back(&trace);
+    } else if (!stack.empty()) {
+      Totals& total = totals[stack.back()->tag];
+      total.count++;
+      total.micros += trace.time - stack.back()->time;
+      stack.pop_back();
+    }
+  }
+
+  std::stringstream s;
+  s << basePath << aapt::file::sDirSep << "report_aapt2_" << getpid() << "_summary.json";
+  FILE* f = android::base::utf8::fopen(s.str().c_str(), "w");
+  if (f == nullptr) {
+    return;
+  }
+  fprintf(f, "{\"peak_rss_kb\" : %" PRId64 ", \"phases\" : [", GetPeakRssKb());
+  const char* separator = "";
+  for (const auto& entry : totals) {
+    fprintf(f, "%s\n  {\"name\" : \"%s\", \"count\" : %" PRId64 ", \"total_us\" : %" PRId64 "}",
+            separator, EscapeJson(entry.first).c_str(), entry.second.count, entry.second.micros);
+    separator = ",";
+  }
+  fprintf(f, "\n]}\n");
+  fclose(f);
+}
+
 void Flush(const std::string& basePath) {
   TRACE_CALL();
   if (basePath.empty()) {
+    // Nothing will ever read these events; drop them so a long-running daemon does not grow.
+    traces.clear();
     return;
   }
 
@@ -78,9 +184,11 @@ void Flush(const std::string& basePath) {
 
   for(const TracePoint& trace : traces) {
     fprintf(f, "{\"ts\" : \"%" PRIu64 "\", \"ph\" : \"%c\", \"tid\" : \"%d\" , \"pid\" : \"%d\", "
-            "\"name\" : \"%s\" },\n", trace.time, trace.type, 0, trace.tid, trace.tag.c_str());
+            "\"name\" : \"%s\" },\n", trace.time, trace.type, trace.thread, trace.tid,
+            EscapeJson(trace.tag).c_str());
   }
   fclose(f);
+  WriteSummary(basePath);
   traces.clear();
 }
 
@@ -26,7 +26,7 @@ namespace aapt {
 
 // Record timestamps for beginning and end of a task and generate systrace json fragments.
 // This is an in-process ftrace which has the advantage of being platform independent.
-// These methods are NOT thread-safe since aapt2 is not multi-threaded.
+// Events may be recorded from any thread; Flush must only be called once worker threads are done.
 
 // Convenience RIAA object to automatically finish an event when object goes out of scope.
 class Trace {
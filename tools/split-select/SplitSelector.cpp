@@ -36,8 +36,8 @@ SplitSelector::SplitSelector(const Vector<SplitDescription>& splits)
 
 static void selectBestFromGroup(const SortedVector<SplitDescription>& splits,
         const SplitDescription& target, Vector<SplitDescription>& splitsOut) {
-    SplitDescription bestSplit;
-    bool isSet = false;
+    // Track the best candidate in place; only the winner is copied out.
+    const SplitDescription* bestSplit = NULL;
     const size_t splitCount = splits.size();
     for (size_t j = 0; j < splitCount; j++) {
         const SplitDescription& thisSplit = splits[j];
@@ -45,14 +45,13 @@ static void selectBestFromGroup(const SortedVector<SplitDescription>& splits,
             continue;
         }
 
-        if (!isSet || thisSplit.isBetterThan(bestSplit, target)) {
-            isSet = true;
-            bestSplit = thisSplit;
+        if (bestSplit == NULL || thisSplit.isBetterThan(*bestSplit, target)) {
+            bestSplit = &thisSplit;
         }
     }
 
-    if (isSet) {
-        splitsOut.add(bestSplit);
+    if (bestSplit != NULL) {
+        splitsOut.add(*bestSplit);
     }
 }
 